@@ -10,6 +10,39 @@
 #include <cctype>
 #include <sstream>
 #include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <future>
+#include <deque>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <cstdio>
+#include <cstdint>
+
+// The refresher, write pipeline and shard coordinator need std::thread/mutex/future.
+// MinGW only provides them with the posix thread model (or win32 threads from GCC 13).
+#if defined(__MINGW32__) && !defined(_GLIBCXX_HAS_GTHREADS)
+#error "std::thread is unavailable: build with a MinGW-w64 GCC using posix threads (see README)"
+#endif
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <poll.h>
+#include <csignal>
+#endif
 
 using namespace std;
 
@@ -19,10 +52,71 @@ const char DB_USER[] = "root";
 const char DB_PASS[] = "123456789";
 const char DB_NAME[] = "JobRecruitment";
 
+// Approximate candidate matching (HNSW graph over hashed TF-IDF vectors)
+const int ANN_DIMENSIONS = 256;      // width of the feature-hashed resume vectors
+const int ANN_M = 16;                // graph links per node (doubled on the base layer)
+const int ANN_EF_CONSTRUCTION = 100; // candidate list size while building the graph
+const int ANN_EF_SEARCH = 50;        // default query breadth: higher = better recall, slower
+const int ANN_TOP_K = 10;
+
+// MySQL FULLTEXT pushdown (MATCH ... AGAINST over jobs and resumes)
+const int FULLTEXT_TOP_K = 10;       // rows returned by a pushed-down search
+
+// Delta synchronization between app instances sharing one database
+const int INDEX_REFRESH_INTERVAL_MS = 2000;  // background poll period for new/edited jobs
+const int INDEX_REFRESH_OVERLAP_SECONDS = 5; // re-read window for rows committed late
+
+// Resident resume store: bytes of encoded postings kept in memory before spilling to disk
+const size_t RESUME_STORE_MEMORY_BUDGET = 64 * 1024 * 1024;
+
+// Group-commit write pipeline: writes that queue up while a commit is in flight
+// ride on the next one, up to this many per transaction
+const int WRITE_BATCH_MAX_ROWS = 64;
+
+// Sharded candidate matching: resumes are split by user_id range across local worker processes
+const int SHARD_DEFAULT_WORKERS = 4;
+const int SHARD_TOP_K = 10;                         // candidates returned by each shard and by the merge
+const int SHARD_REPLY_TIMEOUT_MS = 30000;           // a worker slower than this is killed
+const int SHARD_EXIT_GRACE_MS = 1000;               // time to exit after QUIT before SIGKILL
+const char SHARD_WORKER_FLAG[] = "--shard-worker";  // argv[1] of a worker process
+
 // Secure Database Connection Class
 class Database {
 private:
     MYSQL* conn;
+
+    bool schemaObjectExists(const string& query) {
+        MYSQL_RES* res = executeQueryWithResult(query);
+        if (!res) {
+            throw runtime_error("Failed to inspect schema: " + string(mysql_error(conn)));
+        }
+        MYSQL_ROW row = mysql_fetch_row(res);
+        bool exists = row && atoi(row[0]) > 0;
+        mysql_free_result(res);
+        return exists;
+    }
+
+    // Adds a column to a table created by an older version of the schema
+    void ensureColumn(const string& table, const string& column, const string& definition) {
+        if (schemaObjectExists("SELECT COUNT(*) FROM information_schema.columns "
+                               "WHERE table_schema = DATABASE() AND table_name = '" + table + 
+                               "' AND column_name = '" + column + "'")) return;
+
+        if (mysql_query(conn, ("ALTER TABLE " + table + " ADD COLUMN " + column + " " + definition).c_str()) != 0) {
+            throw runtime_error("Failed to add column " + table + "." + column + ": " + string(mysql_error(conn)));
+        }
+    }
+
+    // MySQL has no CREATE INDEX IF NOT EXISTS
+    void ensureIndex(const string& table, const string& index, const string& definition) {
+        if (schemaObjectExists("SELECT COUNT(*) FROM information_schema.statistics "
+                               "WHERE table_schema = DATABASE() AND table_name = '" + table + 
+                               "' AND index_name = '" + index + "'")) return;
+
+        if (mysql_query(conn, ("ALTER TABLE " + table + " ADD " + definition).c_str()) != 0) {
+            throw runtime_error("Failed to create index " + index + ": " + string(mysql_error(conn)));
+        }
+    }
     
     void initializeDatabase() {
         // Create database if it doesn't exist
@@ -44,7 +138,8 @@ private:
             "email VARCHAR(100) UNIQUE NOT NULL, "
             "password VARCHAR(255) NOT NULL, "
             "role ENUM('JobSeeker', 'Recruiter') NOT NULL, "
-            "resume TEXT)";
+            "resume TEXT, "
+            "updated_at TIMESTAMP(6) NOT NULL DEFAULT CURRENT_TIMESTAMP(6) ON UPDATE CURRENT_TIMESTAMP(6))";
             
         const char* createJobsTable = 
             "CREATE TABLE IF NOT EXISTS Jobs ("
@@ -55,6 +150,7 @@ private:
             "location VARCHAR(100) NOT NULL, "
             "skills_required TEXT NOT NULL, "
             "salary INT NOT NULL, "
+            "updated_at TIMESTAMP(6) NOT NULL DEFAULT CURRENT_TIMESTAMP(6) ON UPDATE CURRENT_TIMESTAMP(6), "
             "FOREIGN KEY (recruiter_id) REFERENCES Users(user_id))";
 
         if (mysql_query(conn, createUsersTable) != 0) {
@@ -64,10 +160,38 @@ private:
         if (mysql_query(conn, createJobsTable) != 0) {
             throw runtime_error("Failed to create Jobs table: " + string(mysql_error(conn)));
         }
+
+        // Watermark columns for delta synchronization of in-memory indexes
+        const string updatedAt = "TIMESTAMP(6) NOT NULL DEFAULT CURRENT_TIMESTAMP(6) ON UPDATE CURRENT_TIMESTAMP(6)";
+        ensureColumn("Users", "updated_at", updatedAt);
+        ensureColumn("Jobs", "updated_at", updatedAt);
+        ensureIndex("Users", "idx_users_updated_at", "INDEX idx_users_updated_at (updated_at)");
+        ensureIndex("Jobs", "idx_jobs_updated_at", "INDEX idx_jobs_updated_at (updated_at)");
+
+        // Secondary indexes. Login stays on the UNIQUE(email) point lookup: it
+        // reads the resume TEXT column, which no secondary index can cover.
+        // (role, user_id) turns the sharded matcher's job-seeker queries into index range
+        // scans: each shard's role = 'JobSeeker' AND user_id range load, and the ORDER BY
+        // user_id partitioning scan without a filesort. It does not cover them; resume
+        // IS NOT NULL and the resume text are still read from the clustered row.
+        ensureIndex("Users", "idx_users_role_user", "INDEX idx_users_role_user (role, user_id)");
+        // Covers the job listing scan and replaces InnoDB's implicit FK index on recruiter_id
+        ensureIndex("Jobs", "idx_jobs_recruiter_listing", 
+                    "INDEX idx_jobs_recruiter_listing (recruiter_id, title, location, salary)");
+        ensureIndex("Jobs", "idx_jobs_location_salary", "INDEX idx_jobs_location_salary (location, salary)");
+        ensureIndex("Jobs", "idx_jobs_salary", "INDEX idx_jobs_salary (salary)");
+
+        // FULLTEXT indexes for MATCH ... AGAINST pushdown (one per ALTER for InnoDB):
+        // candidate ranking, and job search by title words or title and description
+        ensureIndex("Users", "ft_users_resume", "FULLTEXT INDEX ft_users_resume (resume)");
+        ensureIndex("Jobs", "ft_jobs_title", "FULLTEXT INDEX ft_jobs_title (title)");
+        ensureIndex("Jobs", "ft_jobs_title_description", "FULLTEXT INDEX ft_jobs_title_description (title, description)");
     }
 
 public:
-    Database() : conn(mysql_init(nullptr)) {
+    // Worker threads open their own connection with initializeSchema = false;
+    // a MYSQL handle must not be shared between threads
+    explicit Database(bool initializeSchema = true) : conn(mysql_init(nullptr)) {
         if (!conn) throw runtime_error("MySQL initialization failed");
         
         // First connect without specifying a database
@@ -77,12 +201,40 @@ public:
             mysql_close(conn);
             throw runtime_error(err);
         }
+
+        // Delta-sync watermarks are TIMESTAMP values rendered as text. In a zone
+        // with daylight saving the rendered times repeat an hour when DST ends,
+        // and rows edited then would fall behind the watermark; UTC never repeats.
+        if (mysql_query(conn, "SET time_zone = '+00:00'") != 0) {
+            string err = "Failed to set session time zone: ";
+            err += mysql_error(conn);
+            mysql_close(conn);
+            throw runtime_error(err);
+        }
         
+        if (!initializeSchema) {
+            if (mysql_select_db(conn, DB_NAME) != 0) {
+                string err = "Failed to select database: ";
+                err += mysql_error(conn);
+                mysql_close(conn);
+                throw runtime_error(err);
+            }
+            return;
+        }
+
         // Now initialize the database and tables
-        initializeDatabase();
+        try {
+            initializeDatabase();
+        } catch (...) {
+            mysql_close(conn);
+            throw;
+        }
         cout << "Database connected successfully\n";
     }
 
+    Database(const Database&) = delete;
+    Database& operator=(const Database&) = delete;
+
     ~Database() {
         if (conn) mysql_close(conn);
     }
@@ -101,6 +253,12 @@ public:
         if (!executeQuery(query)) return nullptr;
         return mysql_store_result(conn);
     }
+
+    string escape(const string& value) {
+        vector<char> buffer(value.size() * 2 + 1);
+        unsigned long length = mysql_real_escape_string(conn, buffer.data(), value.c_str(), value.size());
+        return string(buffer.data(), length);
+    }
 };
 
 // Utility Functions
@@ -124,6 +282,16 @@ namespace Utils {
         return password;
     }
 
+    // 32-bit FNV-1a, used for feature hashing of terms
+    unsigned int hashTerm(const string& term) {
+        unsigned int hash = 2166136261u;
+        for (char ch : term) {
+            hash ^= static_cast<unsigned char>(ch);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
     vector<string> tokenize(const string& text) {
         vector<string> words;
         string word;
@@ -151,6 +319,721 @@ namespace Utils {
     }
 };
 
+// Text Analysis Pipeline
+//
+// Applied identically to resumes at indexing time and to job descriptions at
+// query time: synonym expansion, stopword removal, then Porter stemming.
+namespace Stopwords {
+    constexpr const char* WORDS[] = {
+        "a", "about", "above", "after", "again", "against", "all", "am", "an", "and", "any", "are", 
+        "as", "at", "be", "because", "been", "before", "being", "below", "between", "both", "but", 
+        "by", "can", "could", "did", "do", "does", "doing", "down", "during", "each", "few", "for", 
+        "from", "further", "had", "has", "have", "having", "he", "her", "here", "hers", "herself", 
+        "him", "himself", "his", "how", "i", "if", "in", "into", "is", "it", "its", "itself", "just", 
+        "me", "more", "most", "my", "myself", "no", "nor", "not", "now", "of", "off", "on", "once", 
+        "only", "or", "other", "our", "ours", "ourselves", "out", "over", "own", "same", "she", 
+        "should", "so", "some", "such", "than", "that", "the", "their", "theirs", "them", 
+        "themselves", "then", "there", "these", "they", "this", "those", "through", "to", "too", 
+        "under", "until", "up", "very", "was", "we", "were", "what", "when", "where", "which", 
+        "while", "who", "whom", "why", "will", "with", "would", "you", "your", "yours", "yourself", 
+        "yourselves"
+    };
+    constexpr int COUNT = sizeof(WORDS) / sizeof(WORDS[0]);
+
+    // Seeded FNV-1a; the seed was searched offline so that the top SLOT_BITS
+    // bits give every stopword its own slot (checked by the static_assert below)
+    constexpr unsigned int SEED = 432544723u;
+    constexpr int SLOT_BITS = 10;
+    constexpr unsigned int TABLE_SIZE = 1u << SLOT_BITS;
+
+    // Compile-time form, used only to build and check the table: it recurses once per character
+    constexpr unsigned int hash(const char* s, unsigned int h = SEED) {
+        return *s ? hash(s + 1, (h ^ static_cast<unsigned char>(*s)) * 16777619u) : h;
+    }
+    constexpr unsigned int slotOf(const char* s) { return hash(s) >> (32 - SLOT_BITS); }
+
+    constexpr int lengthOf(const char* s) { return *s ? 1 + lengthOf(s + 1) : 0; }
+    constexpr int longestFrom(int i, int best = 0) {
+        return i == COUNT ? best : longestFrom(i + 1, lengthOf(WORDS[i]) > best ? lengthOf(WORDS[i]) : best);
+    }
+    constexpr int MAX_LENGTH = longestFrom(0);  // longer words skip the lookup
+
+    constexpr bool collidesWithLater(int i, int j) {
+        return j < COUNT && (slotOf(WORDS[i]) == slotOf(WORDS[j]) || collidesWithLater(i, j + 1));
+    }
+    constexpr bool anyCollision(int i) {
+        return i < COUNT && (collidesWithLater(i, i + 1) || anyCollision(i + 1));
+    }
+    static_assert(!anyCollision(0), "Stopwords::SEED is not a perfect hash for WORDS; search a new seed");
+    static_assert(COUNT <= 127, "slot table stores word indexes as signed char");
+
+    constexpr signed char ownerOf(unsigned int slot, int i = 0) {
+        return i == COUNT ? -1 : (slotOf(WORDS[i]) == slot ? static_cast<signed char>(i) : ownerOf(slot, i + 1));
+    }
+
+    // slot -> index into WORDS (or -1), generated at compile time
+    // (0 .. N-1 built by halving, keeping template depth logarithmic)
+    template<unsigned int... Slots> struct SlotList { typedef SlotList type; };
+    template<typename A, typename B> struct Concat;
+    template<unsigned int... A, unsigned int... B> 
+    struct Concat<SlotList<A...>, SlotList<B...>> : SlotList<A..., (sizeof...(A) + B)...> {};
+    template<unsigned int N> 
+    struct MakeSlots : Concat<typename MakeSlots<N / 2>::type, typename MakeSlots<N - N / 2>::type> {};
+    template<> struct MakeSlots<0> : SlotList<> {};
+    template<> struct MakeSlots<1> : SlotList<0> {};
+
+    template<typename List> struct SlotTable;
+    template<unsigned int... Slots> struct SlotTable<SlotList<Slots...>> {
+        static constexpr signed char owner[sizeof...(Slots)] = { ownerOf(Slots)... };
+    };
+    template<unsigned int... Slots> constexpr signed char SlotTable<SlotList<Slots...>>::owner[sizeof...(Slots)];
+
+    typedef SlotTable<MakeSlots<TABLE_SIZE>::type> Table;
+
+    // Same hash as above as a loop: tokens can be arbitrarily long at runtime
+    inline unsigned int runtimeSlotOf(const string& word) {
+        unsigned int h = SEED;
+        for (char c : word) h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+        return h >> (32 - SLOT_BITS);
+    }
+
+    // One hash, one table probe, at most one string compare
+    inline bool contains(const string& word) {
+        if (word.size() > static_cast<size_t>(MAX_LENGTH)) return false;
+        int owner = Table::owner[runtimeSlotOf(word)];
+        return owner >= 0 && word == WORDS[owner];
+    }
+}
+
+// Porter (1980) suffix stripper, working in place on the word's own buffer.
+// Every rule leaves the word no longer than it was, so stemming never allocates.
+class PorterStemmer {
+private:
+    char* b;  // word buffer
+    int k;    // offset of the last character
+    int j;    // general offset used by ends()/setto()
+
+    static bool isVowelLetter(char c) {
+        return c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u';
+    }
+
+    // 'y' is a consonant at the start or after a vowel, so along a run of y's
+    // the answer alternates from whatever precedes the run
+    bool cons(int i) const {
+        if (b[i] != 'y') return !isVowelLetter(b[i]);
+        int start = i;
+        while (start > 0 && b[start - 1] == 'y') start--;
+        bool first = start == 0 || isVowelLetter(b[start - 1]);
+        return (i - start) % 2 == 0 ? first : !first;
+    }
+
+    // Number of consonant-vowel sequences in b[0..j]
+    int m() const {
+        int n = 0, i = 0;
+        while (true) {
+            if (i > j) return n;
+            if (!cons(i)) break;
+            i++;
+        }
+        i++;
+        while (true) {
+            while (true) {
+                if (i > j) return n;
+                if (cons(i)) break;
+                i++;
+            }
+            i++;
+            n++;
+            while (true) {
+                if (i > j) return n;
+                if (!cons(i)) break;
+                i++;
+            }
+            i++;
+        }
+    }
+
+    bool vowelInStem() const {
+        for (int i = 0; i <= j; i++) if (!cons(i)) return true;
+        return false;
+    }
+
+    bool doubleConsonant(int i) const {
+        return i >= 1 && b[i] == b[i - 1] && cons(i);
+    }
+
+    // consonant-vowel-consonant ending, last consonant not w, x or y
+    bool cvc(int i) const {
+        if (i < 2 || !cons(i) || cons(i - 1) || !cons(i - 2)) return false;
+        return b[i] != 'w' && b[i] != 'x' && b[i] != 'y';
+    }
+
+    bool ends(const char* s) {
+        int length = static_cast<int>(strlen(s));
+        if (s[length - 1] != b[k]) return false;
+        if (length > k + 1) return false;
+        if (memcmp(b + k - length + 1, s, length) != 0) return false;
+        j = k - length;
+        return true;
+    }
+
+    void setTo(const char* s) {
+        int length = static_cast<int>(strlen(s));
+        memmove(b + j + 1, s, length);
+        k = j + length;
+    }
+
+    void replace(const char* s) {
+        if (m() > 0) setTo(s);
+    }
+
+    // Plurals and -ed / -ing
+    void step1ab() {
+        if (b[k] == 's') {
+            if (ends("sses")) k -= 2;
+            else if (ends("ies")) setTo("i");
+            else if (k >= 1 && b[k - 1] != 's') k--;
+        }
+        if (ends("eed")) {
+            if (m() > 0) k--;
+        } else if ((ends("ed") || ends("ing")) && vowelInStem()) {
+            k = j;
+            if (ends("at")) setTo("ate");
+            else if (ends("bl")) setTo("ble");
+            else if (ends("iz")) setTo("ize");
+            else if (doubleConsonant(k)) {
+                k--;
+                char ch = b[k];
+                if (ch == 'l' || ch == 's' || ch == 'z') k++;
+            } else if (m() == 1 && cvc(k)) {
+                setTo("e");
+            }
+        }
+    }
+
+    // Terminal y to i when there is another vowel in the stem
+    void step1c() {
+        if (ends("y") && vowelInStem()) b[k] = 'i';
+    }
+
+    // Double suffixes to single ones, keyed on the penultimate letter
+    void step2() {
+        if (k < 1) return;
+        switch (b[k - 1]) {
+            case 'a':
+                if (ends("ational")) { replace("ate"); break; }
+                if (ends("tional")) { replace("tion"); break; }
+                break;
+            case 'c':
+                if (ends("enci")) { replace("ence"); break; }
+                if (ends("anci")) { replace("ance"); break; }
+                break;
+            case 'e':
+                if (ends("izer")) { replace("ize"); break; }
+                break;
+            case 'l':
+                if (ends("bli")) { replace("ble"); break; }
+                if (ends("alli")) { replace("al"); break; }
+                if (ends("entli")) { replace("ent"); break; }
+                if (ends("eli")) { replace("e"); break; }
+                if (ends("ousli")) { replace("ous"); break; }
+                break;
+            case 'o':
+                if (ends("ization")) { replace("ize"); break; }
+                if (ends("ation")) { replace("ate"); break; }
+                if (ends("ator")) { replace("ate"); break; }
+                break;
+            case 's':
+                if (ends("alism")) { replace("al"); break; }
+                if (ends("iveness")) { replace("ive"); break; }
+                if (ends("fulness")) { replace("ful"); break; }
+                if (ends("ousness")) { replace("ous"); break; }
+                break;
+            case 't':
+                if (ends("aliti")) { replace("al"); break; }
+                if (ends("iviti")) { replace("ive"); break; }
+                if (ends("biliti")) { replace("ble"); break; }
+                break;
+            case 'g':
+                if (ends("logi")) { replace("log"); break; }
+                break;
+        }
+    }
+
+    // -ic-, -full, -ness etc.
+    void step3() {
+        switch (b[k]) {
+            case 'e':
+                if (ends("icate")) { replace("ic"); break; }
+                if (ends("ative")) { replace(""); break; }
+                if (ends("alize")) { replace("al"); break; }
+                break;
+            case 'i':
+                if (ends("iciti")) { replace("ic"); break; }
+                break;
+            case 'l':
+                if (ends("ical")) { replace("ic"); break; }
+                if (ends("ful")) { replace(""); break; }
+                break;
+            case 's':
+                if (ends("ness")) { replace(""); break; }
+                break;
+        }
+    }
+
+    // -ant, -ence etc. in context <c>vcvc<v>
+    void step4() {
+        if (k < 1) return;
+        switch (b[k - 1]) {
+            case 'a': if (ends("al")) break; return;
+            case 'c': if (ends("ance") || ends("ence")) break; return;
+            case 'e': if (ends("er")) break; return;
+            case 'i': if (ends("ic")) break; return;
+            case 'l': if (ends("able") || ends("ible")) break; return;
+            case 'n': if (ends("ant") || ends("ement") || ends("ment") || ends("ent")) break; return;
+            case 'o':
+                if (ends("ion") && j >= 0 && (b[j] == 's' || b[j] == 't')) break;
+                if (ends("ou")) break;
+                return;
+            case 's': if (ends("ism")) break; return;
+            case 't': if (ends("ate") || ends("iti")) break; return;
+            case 'u': if (ends("ous")) break; return;
+            case 'v': if (ends("ive")) break; return;
+            case 'z': if (ends("ize")) break; return;
+            default: return;
+        }
+        if (m() > 1) k = j;
+    }
+
+    // Final -e and -ll
+    void step5() {
+        j = k;
+        if (b[k] == 'e') {
+            int a = m();
+            if (a > 1 || (a == 1 && !cvc(k - 1))) k--;
+        }
+        if (b[k] == 'l' && doubleConsonant(k) && m() > 1) k--;
+    }
+
+public:
+    PorterStemmer() : b(nullptr), k(0), j(0) {}
+
+    // Words of one or two letters are left alone
+    // Longer tokens are not English words; leaving them alone also bounds m(),
+    // which rescans the stem for every rule
+    static const size_t MAX_WORD_LENGTH = 64;
+
+    void stem(string& word) {
+        if (word.size() <= 2 || word.size() > MAX_WORD_LENGTH) return;
+        b = &word[0];
+        k = static_cast<int>(word.size()) - 1;
+        j = 0;
+
+        step1ab();
+        if (k > 0) {
+            step1c();
+            step2();
+            step3();
+            step4();
+            step5();
+        }
+        word.resize(k + 1);
+    }
+};
+
+// Which stages of the pipeline are enabled
+struct AnalyzerOptions {
+    bool expandSynonyms;
+    bool removeStopwords;
+    bool stem;
+};
+
+const AnalyzerOptions DEFAULT_ANALYZER_OPTIONS = {true, true, true};
+
+// Single-token abbreviations mapped to the canonical term before stemming
+const char* const DEFAULT_SYNONYMS[][2] = {
+    {"js", "javascript"}, {"ts", "typescript"}, {"py", "python"}, {"golang", "go"},
+    {"k8s", "kubernetes"}, {"postgres", "postgresql"}, {"reactjs", "react"}, {"nodejs", "node"},
+    {"sr", "senior"}, {"jr", "junior"}, {"mgr", "manager"}, {"dev", "developer"}, {"eng", "engineer"}
+};
+
+class TextAnalyzer {
+private:
+    AnalyzerOptions options;
+    unordered_map<string, string> synonyms;
+    mutable PorterStemmer stemmer;
+
+public:
+    explicit TextAnalyzer(const AnalyzerOptions& opts = DEFAULT_ANALYZER_OPTIONS) : options(opts) {
+        for (const auto& entry : DEFAULT_SYNONYMS) {
+            addSynonym(entry[0], entry[1]);
+        }
+    }
+
+    void addSynonym(const string& from, const string& to) { synonyms[from] = to; }
+
+    const AnalyzerOptions& getOptions() const { return options; }
+    void setOptions(const AnalyzerOptions& opts) { options = opts; }
+
+    // Filters and normalizes tokens from Utils::tokenize in place
+    void apply(vector<string>& words) const {
+        size_t kept = 0;
+        for (size_t i = 0; i < words.size(); i++) {
+            string& word = words[i];
+            if (options.expandSynonyms) {
+                auto it = synonyms.find(word);
+                if (it != synonyms.end()) word = it->second;
+            }
+            if (word.empty()) continue;
+            if (options.removeStopwords && Stopwords::contains(word)) continue;
+            if (options.stem) stemmer.stem(word);
+
+            if (kept != i) words[kept] = move(word);
+            kept++;
+        }
+        words.resize(kept);
+    }
+
+    vector<string> analyze(const string& text) const {
+        vector<string> words = Utils::tokenize(text);
+        apply(words);
+        return words;
+    }
+};
+
+// Group-Commit Write Pipeline
+//
+// Registrations, resume updates and job postings are queued and flushed by a
+// background thread on its own connection. Each flush coalesces the pending
+// writes into multi-row statements inside one transaction, so a burst pays for
+// one commit instead of one per write. Callers hold a future that resolves once
+// their write is durable (or has failed).
+struct WriteResult {
+    bool committed;
+    int id;        // new user_id / job_id, or the updated user_id
+    string error;
+};
+
+enum class WriteKind { RegisterUser, UpdateResume, PostJob };
+
+struct PendingWrite {
+    WriteKind kind;
+    int ownerId;            // user_id for UpdateResume, recruiter_id for PostJob
+    vector<string> fields;  // RegisterUser: name, email, password, role, resume
+                            // UpdateResume: resume
+                            // PostJob: title, description, location, skills
+    int salary;
+    chrono::steady_clock::time_point enqueued;
+    promise<WriteResult> done;
+};
+
+class WriteQueue {
+public:
+    // Runs on the flush thread after the batch containing `write` has committed
+    typedef function<void(const PendingWrite& write, int id)> CommitHook;
+
+private:
+    deque<unique_ptr<PendingWrite>> pending;
+    mutex queueMutex;
+    condition_variable wake;
+    bool stopping;
+    CommitHook onCommit;
+    thread flusher;
+
+    // Statistics, guarded by statsMutex
+    mutex statsMutex;
+    long long batches, writes, failedWrites, fallbackBatches;
+    size_t maxBatch;
+    long long batchSizeBuckets[4];  // 1, 2-4, 5-16, >16
+    double totalCommitMs, maxCommitMs, totalWaitMs;
+
+    static double elapsedMs(chrono::steady_clock::time_point start) {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
+
+    // Gap between the AUTO_INCREMENT values of one multi-row INSERT, or 0 when
+    // they are unpredictable. A contiguous run (spaced by auto_increment_increment)
+    // is only guaranteed in the "traditional" and "consecutive" lock modes; MySQL
+    // 8.0 defaults to "interleaved" (2), so on a stock server this is 0.
+    static int insertIdStep(Database& conn) {
+        MYSQL_RES* res = conn.executeQueryWithResult("SELECT @@innodb_autoinc_lock_mode, @@auto_increment_increment");
+        if (!res) return 0;
+        MYSQL_ROW row = mysql_fetch_row(res);
+        int step = row && row[0] && row[1] && atoi(row[0]) <= 1 ? atoi(row[1]) : 0;
+        mysql_free_result(res);
+        return max(step, 0);
+    }
+
+    static string quoted(Database& conn, const string& value) {
+        return "'" + conn.escape(value) + "'";
+    }
+
+    static string insertValues(Database& conn, const PendingWrite& w) {
+        if (w.kind == WriteKind::RegisterUser) {
+            return "(" + quoted(conn, w.fields[0]) + ", " + quoted(conn, w.fields[1]) + ", " + 
+                   quoted(conn, w.fields[2]) + ", " + quoted(conn, w.fields[3]) + ", " + 
+                   quoted(conn, w.fields[4]) + ")";
+        }
+        return "(" + to_string(w.ownerId) + ", " + quoted(conn, w.fields[0]) + ", " + 
+               quoted(conn, w.fields[1]) + ", " + quoted(conn, w.fields[2]) + ", " + 
+               quoted(conn, w.fields[3]) + ", " + to_string(w.salary) + ")";
+    }
+
+    // Users always go in as one multi-row INSERT: whatever the lock mode, the
+    // new ids are read back by the UNIQUE email inside the same transaction
+    static bool insertUsers(Database& conn, const vector<PendingWrite*>& rows, map<PendingWrite*, int>& ids) {
+        if (rows.empty()) return true;
+
+        string query = "INSERT INTO Users (name, email, password, role, resume) VALUES ";
+        string emails;
+        for (size_t i = 0; i < rows.size(); i++) {
+            if (i > 0) {
+                query += ", ";
+                emails += ", ";
+            }
+            query += insertValues(conn, *rows[i]);
+            emails += quoted(conn, rows[i]->fields[1]);
+        }
+        if (!conn.executeQuery(query)) return false;
+
+        MYSQL_RES* res = conn.executeQueryWithResult("SELECT user_id, email FROM Users WHERE email IN (" + emails + ")");
+        if (!res) return false;
+        map<string, int> idOfEmail;
+        MYSQL_ROW row;
+        while ((row = mysql_fetch_row(res))) idOfEmail[row[1]] = atoi(row[0]);
+        mysql_free_result(res);
+
+        for (PendingWrite* w : rows) {
+            auto it = idOfEmail.find(w->fields[1]);
+            if (it == idOfEmail.end()) return false;
+            ids[w] = it->second;
+        }
+        return true;
+    }
+
+    // Jobs have no natural key to read new ids back by, so they share one
+    // statement only when the server guarantees an id step; otherwise
+    // (the MySQL 8.0 default) each row is its own INSERT in the transaction
+    static bool insertJobs(Database& conn, const vector<PendingWrite*>& rows, 
+                           int idStep, map<PendingWrite*, int>& ids) {
+        const string head = "INSERT INTO Jobs (recruiter_id, title, description, location, skills_required, salary) VALUES ";
+        if (rows.empty()) return true;
+
+        if (idStep > 0) {
+            string query = head;
+            for (size_t i = 0; i < rows.size(); i++) {
+                if (i > 0) query += ", ";
+                query += insertValues(conn, *rows[i]);
+            }
+            if (!conn.executeQuery(query)) return false;
+
+            int firstId = static_cast<int>(mysql_insert_id(conn.getConnection()));
+            for (size_t i = 0; i < rows.size(); i++) ids[rows[i]] = firstId + static_cast<int>(i) * idStep;
+            return true;
+        }
+
+        for (PendingWrite* w : rows) {
+            if (!conn.executeQuery(head + insertValues(conn, *w))) return false;
+            ids[w] = static_cast<int>(mysql_insert_id(conn.getConnection()));
+        }
+        return true;
+    }
+
+    // Runs one batch as a single transaction; on success fills ids for every
+    // write, on failure sets error to the message of the statement that failed
+    static bool commitBatch(Database& conn, const vector<PendingWrite*>& batch, 
+                            int idStep, map<PendingWrite*, int>& ids, string& error) {
+        vector<PendingWrite*> users, jobs;
+        map<int, PendingWrite*> latestResume;  // coalesced: last update per user wins
+        for (PendingWrite* w : batch) {
+            if (w->kind == WriteKind::RegisterUser) users.push_back(w);
+            else if (w->kind == WriteKind::PostJob) jobs.push_back(w);
+            else latestResume[w->ownerId] = w;
+        }
+
+        if (!conn.executeQuery("START TRANSACTION")) {
+            error = mysql_error(conn.getConnection());
+            return false;
+        }
+
+        bool ok = insertUsers(conn, users, ids) && insertJobs(conn, jobs, idStep, ids);
+
+        if (ok && !latestResume.empty()) {
+            string cases, idList;
+            for (const auto& entry : latestResume) {
+                cases += " WHEN " + to_string(entry.first) + " THEN " + quoted(conn, entry.second->fields[0]);
+                idList += (idList.empty() ? "" : ", ") + to_string(entry.first);
+            }
+            ok = conn.executeQuery("UPDATE Users SET resume = CASE user_id" + cases + " END WHERE user_id IN (" + idList + ")");
+        }
+
+        if (!ok || !conn.executeQuery("COMMIT")) {
+            // A successful ROLLBACK clears mysql_error, so read it first
+            error = mysql_error(conn.getConnection());
+            if (error.empty()) error = "new row id could not be read back";
+            conn.executeQuery("ROLLBACK");
+            ids.clear();
+            return false;
+        }
+
+        for (PendingWrite* w : batch) {
+            if (w->kind == WriteKind::UpdateResume) ids[w] = w->ownerId;
+        }
+        return true;
+    }
+
+    void recordBatch(size_t size, double commitMs, double waitMs, size_t failed, bool fellBack) {
+        lock_guard<mutex> lock(statsMutex);
+        batches++;
+        writes += size;
+        failedWrites += failed;
+        if (fellBack) fallbackBatches++;
+        maxBatch = max(maxBatch, size);
+        batchSizeBuckets[size == 1 ? 0 : size <= 4 ? 1 : size <= 16 ? 2 : 3]++;
+        totalCommitMs += commitMs;
+        maxCommitMs = max(maxCommitMs, commitMs);
+        totalWaitMs += waitMs;
+    }
+
+    void flush(Database& conn, int idStep, vector<unique_ptr<PendingWrite>>& batch) {
+        vector<PendingWrite*> writesInBatch;
+        double waitMs = 0.0;
+        for (const auto& w : batch) {
+            writesInBatch.push_back(w.get());
+            waitMs += elapsedMs(w->enqueued);
+        }
+
+        auto start = chrono::steady_clock::now();
+        map<PendingWrite*, int> ids;
+        bool fellBack = false;
+        map<PendingWrite*, string> errors;
+
+        string batchError;
+        if (!commitBatch(conn, writesInBatch, idStep, ids, batchError)) {
+            // Isolate the failing write(s): retry each in its own transaction
+            fellBack = writesInBatch.size() > 1;
+            for (PendingWrite* w : writesInBatch) {
+                map<PendingWrite*, int> single;
+                string error;
+                if (commitBatch(conn, vector<PendingWrite*>(1, w), idStep, single, error)) {
+                    ids[w] = single[w];
+                } else {
+                    errors[w] = error;
+                }
+            }
+        }
+        double commitMs = elapsedMs(start);
+        recordBatch(writesInBatch.size(), commitMs, waitMs, errors.size(), fellBack);
+
+        // Index updates only ever see committed rows
+        for (PendingWrite* w : writesInBatch) {
+            auto it = ids.find(w);
+            if (it == ids.end()) {
+                w->done.set_value(WriteResult{false, -1, errors[w]});
+                continue;
+            }
+            if (onCommit) onCommit(*w, it->second);
+            w->done.set_value(WriteResult{true, it->second, ""});
+        }
+    }
+
+    void flushLoop() {
+        mysql_thread_init();
+        unique_ptr<Database> conn;
+        int idStep = 0;
+        try {
+            conn.reset(new Database(false));
+            idStep = insertIdStep(*conn);
+        } catch (const exception& e) {
+            cerr << "Write pipeline unavailable: " << e.what() << "\n";
+        }
+
+        // Leader/follower group commit: an idle flusher commits the first write
+        // at once, and everything submitted while that commit is in flight
+        // follows in the next batch. Nobody waits for a timer.
+        unique_lock<mutex> lock(queueMutex);
+        while (true) {
+            wake.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (pending.empty()) break;
+
+            vector<unique_ptr<PendingWrite>> batch;
+            while (!pending.empty() && batch.size() < static_cast<size_t>(WRITE_BATCH_MAX_ROWS)) {
+                batch.push_back(move(pending.front()));
+                pending.pop_front();
+            }
+
+            lock.unlock();
+            if (conn) {
+                flush(*conn, idStep, batch);
+            } else {
+                for (auto& w : batch) w->done.set_value(WriteResult{false, -1, "no database connection"});
+            }
+            lock.lock();
+        }
+        lock.unlock();
+
+        conn.reset();
+        mysql_thread_end();
+    }
+
+public:
+    WriteQueue() 
+        : stopping(false), batches(0), writes(0), failedWrites(0), fallbackBatches(0), maxBatch(0), 
+          totalCommitMs(0.0), maxCommitMs(0.0), totalWaitMs(0.0) {
+        fill(batchSizeBuckets, batchSizeBuckets + 4, 0LL);
+        flusher = thread(&WriteQueue::flushLoop, this);
+    }
+
+    WriteQueue(const WriteQueue&) = delete;
+    WriteQueue& operator=(const WriteQueue&) = delete;
+
+    // Drains everything still queued before returning
+    ~WriteQueue() {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        if (flusher.joinable()) flusher.join();
+    }
+
+    // Must be set before the first write is submitted
+    void setCommitHook(CommitHook hook) { onCommit = hook; }
+
+    future<WriteResult> submit(WriteKind kind, int ownerId, const vector<string>& fields, int salary = 0) {
+        unique_ptr<PendingWrite> w(new PendingWrite());
+        w->kind = kind;
+        w->ownerId = ownerId;
+        w->fields = fields;
+        w->salary = salary;
+        w->enqueued = chrono::steady_clock::now();
+        future<WriteResult> result = w->done.get_future();
+
+        {
+            lock_guard<mutex> lock(queueMutex);
+            pending.push_back(move(w));
+        }
+        wake.notify_one();
+        return result;
+    }
+
+    void printStats() {
+        lock_guard<mutex> lock(statsMutex);
+        cout << "\nWrite Pipeline Statistics\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << fixed << setprecision(3);
+        cout << "Batches committed:        " << batches << " (" << fallbackBatches << " retried row by row)\n";
+        cout << "Writes:                   " << writes << " (" << failedWrites << " failed)\n";
+        cout << "Average batch size:       " << (batches ? static_cast<double>(writes) / batches : 0.0) << "\n";
+        cout << "Largest batch:            " << maxBatch << "\n";
+        cout << "Batch sizes 1/2-4/5-16/>16: " << batchSizeBuckets[0] << "/" << batchSizeBuckets[1] << "/" 
+             << batchSizeBuckets[2] << "/" << batchSizeBuckets[3] << "\n";
+        cout << "Commit latency avg/max:   " << (batches ? totalCommitMs / batches : 0.0) << " / " << maxCommitMs << " ms\n";
+        cout << "Queue wait per write avg: " << (writes ? totalWaitMs / writes : 0.0) << " ms\n";
+        cout << "-----------------------------------------------------------------\n";
+    }
+};
+
 // User Management
 class UserManager {
 protected:
@@ -164,24 +1047,19 @@ protected:
 public:
     UserManager() : user_id(-1), logged_in(false) {}
 
-    bool registerUser(Database& db, const string& name, const string& email, 
-                     const string& password, const string& role, const string& resume = "") {
+    // Queued through the group-commit pipeline; the future resolves when durable
+    future<WriteResult> registerUser(WriteQueue& writes, const string& name, const string& email, 
+                                     const string& password, const string& role, const string& resume = "") {
         if (role != "JobSeeker" && role != "Recruiter") {
             cerr << "Invalid role. Must be 'JobSeeker' or 'Recruiter'.\n";
-            return false;
+            promise<WriteResult> rejected;
+            rejected.set_value(WriteResult{false, -1, "invalid role"});
+            return rejected.get_future();
         }
 
         string hashed_pwd = Utils::hashPassword(password);
-        string query = "INSERT INTO Users (name, email, password, role, resume) VALUES ('" +
-                       Utils::trim(name) + "', '" + Utils::trim(email) + "', '" + 
-                       hashed_pwd + "', '" + role + "', '" + Utils::trim(resume) + "')";
-
-        if (!db.executeQuery(query)) {
-            return false;
-        }
-        
-        cout << "Registration successful\n";
-        return true;
+        return writes.submit(WriteKind::RegisterUser, -1, 
+                             {Utils::trim(name), Utils::trim(email), hashed_pwd, role, Utils::trim(resume)});
     }
 
     bool login(Database& db, const string& email, const string& password) {
@@ -204,333 +1082,2136 @@ public:
             return true;
         }
 
-        mysql_free_result(res);
-        cerr << "Invalid credentials\n";
-        return false;
+        mysql_free_result(res);
+        cerr << "Invalid credentials\n";
+        return false;
+    }
+
+    // Waits for the queued update to commit before changing the local copy
+    bool updateResume(WriteQueue& writes, const string& newResume) {
+        if (!logged_in) {
+            cerr << "You must be logged in to update your resume\n";
+            return false;
+        }
+
+        WriteResult result = writes.submit(WriteKind::UpdateResume, user_id, {Utils::trim(newResume)}).get();
+        if (!result.committed) {
+            cerr << "Resume update failed: " << result.error << "\n";
+            return false;
+        }
+
+        resume = newResume;
+        cout << "Resume updated successfully\n";
+        return true;
+    }
+
+    bool isLoggedIn() const { return logged_in; }
+    string getRole() const { return role; }
+    int getUserId() const { return user_id; }
+    string getName() const { return name; }
+    string getResume() const { return resume; }
+};
+
+// Job Management
+class JobManager {
+private:
+    Database& db;
+    WriteQueue& writes;
+
+public:
+    JobManager(Database& database, WriteQueue& writeQueue) : db(database), writes(writeQueue) {}
+
+    // Queued through the group-commit pipeline; the future resolves when durable
+    future<WriteResult> postJob(int recruiter_id, const string& title, const string& description, 
+                                const string& location, const string& skills, int salary) {
+        return writes.submit(WriteKind::PostJob, recruiter_id, 
+                             {Utils::trim(title), Utils::trim(description), Utils::trim(location), Utils::trim(skills)}, 
+                             salary);
+    }
+
+    void displayAllJobs() {
+        string query = "SELECT j.job_id, j.title, j.location, j.salary, u.name FROM Jobs j "
+                       "JOIN Users u ON j.recruiter_id = u.user_id";
+        
+        MYSQL_RES* res = db.executeQueryWithResult(query);
+        if (!res) return;
+
+        cout << "\nAvailable Jobs:\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << left << setw(5) << "ID" << setw(25) << "Title" << setw(20) << "Location" 
+             << setw(10) << "Salary" << setw(20) << "Recruiter" << "\n";
+        cout << "-----------------------------------------------------------------\n";
+
+        MYSQL_ROW row;
+        while ((row = mysql_fetch_row(res))) {
+            cout << left << setw(5) << row[0] << setw(25) << (strlen(row[1]) > 20 ? string(row[1]).substr(0, 17) + "..." : row[1])
+                 << setw(20) << row[2] << setw(10) << row[3] << setw(20) << row[4] << "\n";
+        }
+        cout << "-----------------------------------------------------------------\n";
+        mysql_free_result(res);
+    }
+};
+
+// Job Search using Trie
+//
+// The trie is persistent: an update copies only the nodes along the changed
+// path and publishes a new root, so searches always read a complete snapshot
+// and never wait on the background refresher (RCU-style version swap).
+class JobSearchEngine {
+private:
+    struct TrieNode {
+        shared_ptr<const TrieNode> children[26];
+        vector<int> jobIds;
+    };
+    typedef shared_ptr<const TrieNode> NodePtr;
+
+    Database& db;
+    NodePtr root;  // published version; accessed only via atomic_load/atomic_store
+
+    // Writer state (applyDelta), guarded by writerMutex
+    mutex writerMutex;
+    map<int, string> indexedKeys;  // job_id -> trie key currently holding it
+    int maxJobId;
+    string updatedWatermark;       // newest Jobs.updated_at applied
+
+    // Background refresher
+    thread refresher;
+    mutex refresherMutex;
+    condition_variable refresherWake;
+    bool stopping;
+
+    static string trieKey(const string& title) {
+        string key;
+        for (char ch : title) {
+            ch = tolower(ch);
+            if (ch < 'a' || ch > 'z') continue;
+            key += ch;
+        }
+        return key;
+    }
+
+    // Returns a copy of `node` with jobId added to / removed from `key`;
+    // untouched subtrees are shared with the previous version
+    static NodePtr withJob(const NodePtr& node, const string& key, size_t pos, int jobId, bool add) {
+        shared_ptr<TrieNode> copy = node ? make_shared<TrieNode>(*node) : make_shared<TrieNode>();
+
+        if (pos == key.size()) {
+            auto it = find(copy->jobIds.begin(), copy->jobIds.end(), jobId);
+            if (add && it == copy->jobIds.end()) copy->jobIds.push_back(jobId);
+            if (!add && it != copy->jobIds.end()) copy->jobIds.erase(it);
+        } else {
+            int c = key[pos] - 'a';
+            copy->children[c] = withJob(node ? node->children[c] : NodePtr(), key, pos + 1, jobId, add);
+        }
+        return copy;
+    }
+
+    // Reads jobs inserted or edited since the watermarks and publishes a new
+    // trie version containing them. Returns the number of rows applied.
+    int applyDelta(Database& source) {
+        lock_guard<mutex> lock(writerMutex);
+
+        string query = "SELECT job_id, title, updated_at FROM Jobs";
+        if (!updatedWatermark.empty()) {
+            query += " WHERE job_id > " + to_string(maxJobId) + 
+                     " OR updated_at >= TIMESTAMPADD(SECOND, -" + to_string(INDEX_REFRESH_OVERLAP_SECONDS) + 
+                     ", '" + updatedWatermark + "')";
+        }
+
+        MYSQL_RES* res = source.executeQueryWithResult(query);
+        if (!res) return 0;
+
+        NodePtr next = atomic_load(&root);
+        int applied = 0;
+
+        MYSQL_ROW row;
+        while ((row = mysql_fetch_row(res))) {
+            int jobId = atoi(row[0]);
+            string key = trieKey(row[1]);
+            string updatedAt = row[2];
+
+            maxJobId = max(maxJobId, jobId);
+            if (updatedAt > updatedWatermark) updatedWatermark = updatedAt;
+
+            auto it = indexedKeys.find(jobId);
+            if (it != indexedKeys.end()) {
+                if (it->second == key) continue;  // re-read inside the overlap window
+                next = withJob(next, it->second, 0, jobId, false);
+            }
+            next = withJob(next, key, 0, jobId, true);
+            indexedKeys[jobId] = key;
+            applied++;
+        }
+        mysql_free_result(res);
+
+        if (applied > 0) atomic_store(&root, next);
+        return applied;
+    }
+
+    void refreshLoop() {
+        mysql_thread_init();
+        try {
+            Database conn(false);
+            unique_lock<mutex> lock(refresherMutex);
+            while (!stopping) {
+                refresherWake.wait_for(lock, chrono::milliseconds(INDEX_REFRESH_INTERVAL_MS));
+                if (stopping) break;
+
+                lock.unlock();
+                applyDelta(conn);
+                lock.lock();
+            }
+        } catch (const exception& e) {
+            cerr << "Job index refresher stopped: " << e.what() << "\n";
+        }
+        mysql_thread_end();
+    }
+
+public:
+    // Constructor
+    explicit JobSearchEngine(Database& database) 
+        : db(database), root(make_shared<TrieNode>()), maxJobId(0), stopping(false) {
+        loadJobsFromDatabase();
+        refresher = thread(&JobSearchEngine::refreshLoop, this);
+    }
+
+    // Owns a running thread; neither copyable nor movable
+    JobSearchEngine(const JobSearchEngine&) = delete;
+    JobSearchEngine& operator=(const JobSearchEngine&) = delete;
+
+    // Destructor
+    ~JobSearchEngine() {
+        {
+            lock_guard<mutex> lock(refresherMutex);
+            stopping = true;
+        }
+        refresherWake.notify_all();
+        if (refresher.joinable()) refresher.join();
+    }
+
+    // Public interface
+    void loadJobsFromDatabase() {
+        {
+            lock_guard<mutex> lock(writerMutex);
+            indexedKeys.clear();
+            maxJobId = 0;
+            updatedWatermark.clear();
+            atomic_store(&root, NodePtr(make_shared<TrieNode>()));
+        }
+        applyDelta(db);
+    }
+
+    // Indexes a job this instance has just committed, without a round trip
+    void indexJob(int jobId, const string& title) {
+        lock_guard<mutex> lock(writerMutex);
+        string key = trieKey(title);
+        if (indexedKeys.count(jobId)) return;
+
+        atomic_store(&root, withJob(atomic_load(&root), key, 0, jobId, true));
+        indexedKeys[jobId] = key;
+        maxJobId = max(maxJobId, jobId);
+    }
+
+    void searchJobs(const string& prefix) {
+        NodePtr node = atomic_load(&root);
+        for (char ch : prefix) {
+            ch = tolower(ch);
+            if (ch < 'a' || ch > 'z') continue;
+            
+            if (!node->children[ch - 'a']) {
+                cout << "No jobs found with this prefix\n";
+                return;
+            }
+            node = node->children[ch - 'a'];
+        }
+
+        if (node->jobIds.empty()) {
+            cout << "No jobs found with this prefix\n";
+            return;
+        }
+
+        cout << "\nMatching Jobs:\n";
+        cout << "----------------------------------------\n";
+        for (int jobId : node->jobIds) {
+            string query = "SELECT j.title, j.location, j.salary, u.name FROM Jobs j "
+                          "JOIN Users u ON j.recruiter_id = u.user_id "
+                          "WHERE j.job_id = " + to_string(jobId);
+            
+            MYSQL_RES* res = db.executeQueryWithResult(query);
+            if (res) {
+                MYSQL_ROW row = mysql_fetch_row(res);
+                if (row) {
+                    cout << "ID: " << jobId << " | Title: " << row[0] 
+                         << " | Location: " << row[1] 
+                         << " | Salary: " << row[2] 
+                         << " | Recruiter: " << row[3] << "\n";
+                }
+                mysql_free_result(res);
+            }
+        }
+        cout << "----------------------------------------\n";
+    }
+
+    // Word search pushed down to MySQL: MATCH ... AGAINST on ft_jobs_title, or
+    // on ft_jobs_title_description when the description should count too
+    void searchJobsFullText(const string& keywords, bool includeDescription) {
+        string columns = includeDescription ? "j.title, j.description" : "j.title";
+        string match = "MATCH(" + columns + ") AGAINST('" + db.escape(keywords) + "' IN NATURAL LANGUAGE MODE)";
+        string query = "SELECT j.job_id, j.title, j.location, j.salary, u.name, " + match + " AS score "
+                       "FROM Jobs j JOIN Users u ON j.recruiter_id = u.user_id "
+                       "WHERE " + match + " ORDER BY score DESC LIMIT " + to_string(FULLTEXT_TOP_K);
+
+        MYSQL_RES* res = db.executeQueryWithResult(query);
+        if (!res) {
+            cerr << "Full-text job search failed\n";
+            return;
+        }
+
+        MYSQL_ROW row = mysql_fetch_row(res);
+        if (!row) {
+            cout << "No jobs found matching these words\n";
+            mysql_free_result(res);
+            return;
+        }
+
+        cout << "\nMatching Jobs:\n";
+        cout << "----------------------------------------\n";
+        for (; row; row = mysql_fetch_row(res)) {
+            cout << "ID: " << row[0] << " | Title: " << row[1] 
+                 << " | Location: " << row[2] 
+                 << " | Salary: " << row[3] 
+                 << " | Recruiter: " << row[4] 
+                 << " | Relevance: " << fixed << setprecision(3) << atof(row[5]) << "\n";
+        }
+        cout << "----------------------------------------\n";
+        mysql_free_result(res);
+    }
+};
+
+// Approximate Nearest-Neighbour Index (HNSW) over unit-length vectors
+class HnswIndex {
+private:
+    int dim;
+    int M;
+    int efConstruction;
+    double levelMult;
+    vector<float> data;                 // one row of `dim` floats per node
+    vector<int> labels;
+    vector<char> deleted;               // superseded nodes: still routed through, never returned
+    map<int, int> nodeOfLabel;
+    vector<vector<vector<int>>> links;  // links[node][level]
+    int entryPoint;
+    int maxLevel;
+    mt19937 rng;
+
+    const float* vectorAt(int node) const { return &data[static_cast<size_t>(node) * dim]; }
+
+    // Cosine distance; all stored vectors are L2-normalized
+    float distance(const float* a, const float* b) const {
+        float dot = 0.0f;
+        for (int i = 0; i < dim; i++) dot += a[i] * b[i];
+        return 1.0f - dot;
+    }
+
+    int randomLevel() {
+        uniform_real_distribution<double> uniform(0.0, 1.0);
+        double r = uniform(rng);
+        if (r <= 0.0) r = numeric_limits<double>::min();
+        return static_cast<int>(-log(r) * levelMult);
+    }
+
+    int greedyClosest(const float* query, int ep, int level) const {
+        float best = distance(query, vectorAt(ep));
+        bool improved = true;
+        while (improved) {
+            improved = false;
+            for (int neighbour : links[ep][level]) {
+                float d = distance(query, vectorAt(neighbour));
+                if (d < best) {
+                    best = d;
+                    ep = neighbour;
+                    improved = true;
+                }
+            }
+        }
+        return ep;
+    }
+
+    // Best-first search on one layer; returns up to `ef` nodes sorted by distance
+    vector<pair<float, int>> searchLayer(const float* query, int ep, int ef, int level) const {
+        vector<char> visited(labels.size(), 0);
+        priority_queue<pair<float, int>, vector<pair<float, int>>, greater<pair<float, int>>> candidates;
+        priority_queue<pair<float, int>> results;
+
+        float d = distance(query, vectorAt(ep));
+        candidates.push({d, ep});
+        results.push({d, ep});
+        visited[ep] = 1;
+
+        while (!candidates.empty()) {
+            pair<float, int> current = candidates.top();
+            if (current.first > results.top().first && static_cast<int>(results.size()) >= ef) break;
+            candidates.pop();
+
+            for (int neighbour : links[current.second][level]) {
+                if (visited[neighbour]) continue;
+                visited[neighbour] = 1;
+
+                float nd = distance(query, vectorAt(neighbour));
+                if (static_cast<int>(results.size()) < ef || nd < results.top().first) {
+                    candidates.push({nd, neighbour});
+                    results.push({nd, neighbour});
+                    if (static_cast<int>(results.size()) > ef) results.pop();
+                }
+            }
+        }
+
+        vector<pair<float, int>> sorted;
+        sorted.reserve(results.size());
+        while (!results.empty()) {
+            sorted.push_back(results.top());
+            results.pop();
+        }
+        reverse(sorted.begin(), sorted.end());
+        return sorted;
+    }
+
+    // Neighbour selection heuristic: prefer candidates that are not already
+    // covered by a closer selected neighbour, then top up with the rest
+    vector<int> selectNeighbours(const vector<pair<float, int>>& sortedCandidates, size_t m) const {
+        vector<int> selected;
+        vector<int> pruned;
+        for (const auto& candidate : sortedCandidates) {
+            if (selected.size() >= m) break;
+            bool diverse = true;
+            for (int s : selected) {
+                if (distance(vectorAt(candidate.second), vectorAt(s)) < candidate.first) {
+                    diverse = false;
+                    break;
+                }
+            }
+            if (diverse) selected.push_back(candidate.second);
+            else pruned.push_back(candidate.second);
+        }
+        for (size_t i = 0; i < pruned.size() && selected.size() < m; i++) {
+            selected.push_back(pruned[i]);
+        }
+        return selected;
+    }
+
+    void shrinkLinks(int node, int level) {
+        size_t maxLinks = level == 0 ? 2 * M : M;
+        vector<int>& nodeLinks = links[node][level];
+        if (nodeLinks.size() <= maxLinks) return;
+
+        vector<pair<float, int>> candidates;
+        for (int neighbour : nodeLinks) {
+            candidates.push_back({distance(vectorAt(node), vectorAt(neighbour)), neighbour});
+        }
+        sort(candidates.begin(), candidates.end());
+        nodeLinks = selectNeighbours(candidates, maxLinks);
+    }
+
+public:
+    HnswIndex(int dimensions, int m, int efConstruction)
+        : dim(dimensions), M(m), efConstruction(efConstruction),
+          levelMult(1.0 / log(static_cast<double>(max(m, 2)))),
+          entryPoint(-1), maxLevel(-1), rng(42) {}
+
+    void clear() {
+        data.clear();
+        labels.clear();
+        deleted.clear();
+        nodeOfLabel.clear();
+        links.clear();
+        entryPoint = -1;
+        maxLevel = -1;
+        rng.seed(42);
+    }
+
+    size_t size() const { return nodeOfLabel.size(); }
+
+    // Adding an existing label replaces its vector; the old node becomes a tombstone
+    void add(int label, const vector<float>& v) {
+        int node = static_cast<int>(labels.size());
+        auto existing = nodeOfLabel.find(label);
+        if (existing != nodeOfLabel.end()) deleted[existing->second] = 1;
+        nodeOfLabel[label] = node;
+
+        labels.push_back(label);
+        deleted.push_back(0);
+        data.insert(data.end(), v.begin(), v.end());
+
+        int level = randomLevel();
+        links.push_back(vector<vector<int>>(level + 1));
+
+        if (entryPoint < 0) {
+            entryPoint = node;
+            maxLevel = level;
+            return;
+        }
+
+        const float* query = vectorAt(node);
+        int ep = entryPoint;
+        for (int l = maxLevel; l > level; l--) {
+            ep = greedyClosest(query, ep, l);
+        }
+
+        for (int l = min(level, maxLevel); l >= 0; l--) {
+            vector<pair<float, int>> candidates = searchLayer(query, ep, efConstruction, l);
+            links[node][l] = selectNeighbours(candidates, M);
+            for (int neighbour : links[node][l]) {
+                links[neighbour][l].push_back(node);
+                shrinkLinks(neighbour, l);
+            }
+            ep = candidates.front().second;
+        }
+
+        if (level > maxLevel) {
+            maxLevel = level;
+            entryPoint = node;
+        }
+    }
+
+    // Returns up to k (label, cosine similarity) pairs, most similar first
+    vector<pair<int, double>> search(const vector<float>& query, size_t k, int ef) const {
+        vector<pair<int, double>> hits;
+        if (entryPoint < 0) return hits;
+
+        int ep = entryPoint;
+        for (int l = maxLevel; l > 0; l--) {
+            ep = greedyClosest(query.data(), ep, l);
+        }
+
+        vector<pair<float, int>> nearest = searchLayer(query.data(), ep, max(ef, static_cast<int>(k)), 0);
+        for (size_t i = 0; i < nearest.size() && hits.size() < k; i++) {
+            if (deleted[nearest[i].second]) continue;
+            hits.push_back({labels[nearest[i].second], 1.0 - nearest[i].first});
+        }
+        return hits;
+    }
+};
+
+// Compact Resume Store
+//
+// Each resume is kept as a varint-coded list of (term id delta, count) pairs
+// over a shared term dictionary, plus a precomputed display snippet. Only the
+// posting bytes count against the memory budget (names, snippets and the
+// dictionary stay resident); past it, the least recently written postings are
+// moved to a spill file and read back on demand.
+class ResumeStore {
+public:
+    typedef vector<pair<int, int>> Postings;  // (term id, occurrences), ascending ids
+
+private:
+    struct Entry {
+        int userId;
+        int totalWords;
+        string name;
+        string snippet;
+        string encoded;          // empty while spilled
+        bool resident;
+        long diskOffset;
+        unsigned int diskLength;
+        list<int>::iterator lruPosition;
+        size_t legacyBytes;      // this resume's share of ResumeStore::legacyBytes
+    };
+
+    unordered_map<string, int> termIds;
+    vector<string> terms;
+    vector<unsigned int> termHashes;
+
+    vector<Entry> entries;
+    unordered_map<int, int> positionOfUser;
+
+    list<int> residentOrder;     // oldest write first
+    size_t memoryBudget;
+    size_t residentBytes;
+    FILE* spillFile;
+    size_t spillFileBytes;       // appended so far, including replaced copies
+    size_t liveSpillBytes;       // still referenced by spilled entries
+    size_t legacyBytes;          // what the old per-query copies would have held
+    string scratch;
+
+    static void appendVarint(string& out, unsigned int value) {
+        while (value >= 0x80) {
+            out += static_cast<char>((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        out += static_cast<char>(value);
+    }
+
+    static unsigned int readVarint(const string& in, size_t& pos) {
+        unsigned int value = 0;
+        int shift = 0;
+        while (pos < in.size()) {
+            unsigned char byte = static_cast<unsigned char>(in[pos++]);
+            value |= static_cast<unsigned int>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) break;
+            shift += 7;
+        }
+        return value;
+    }
+
+    static size_t heapBytes(const string& s) {
+        return s.size() > 15 ? s.size() + 1 : 0;  // beyond the small-string buffer
+    }
+
+    // allResumes + resumeWords word copies and a map<string, double> of TF
+    static size_t legacyFootprint(const vector<string>& words, const map<int, int>& counts, 
+                                  const vector<string>& dictionary) {
+        size_t wordBytes = sizeof(vector<string>) + words.size() * sizeof(string);
+        for (const string& w : words) wordBytes += heapBytes(w);
+
+        size_t tfBytes = sizeof(map<string, double>);
+        for (const auto& entry : counts) {
+            tfBytes += 32 + sizeof(string) + sizeof(double) + heapBytes(dictionary[entry.first]);
+        }
+        return 2 * wordBytes + tfBytes;
+    }
+
+    const string& encodedBytes(int position) {
+        Entry& e = entries[position];
+        if (e.resident) return e.encoded;
+
+        scratch.resize(e.diskLength);
+        if (fseek(spillFile, e.diskOffset, SEEK_SET) != 0 || 
+            fread(&scratch[0], 1, e.diskLength, spillFile) != e.diskLength) {
+            throw runtime_error("Failed to read spilled resume for user " + to_string(e.userId));
+        }
+        return scratch;
+    }
+
+    void release(int position) {
+        Entry& e = entries[position];
+        if (!e.resident) return;
+        residentBytes -= e.encoded.size();
+        residentOrder.erase(e.lruPosition);
+        string().swap(e.encoded);
+        e.resident = false;
+    }
+
+    // An anonymous file in the user's temp directory. tmpfile() is not used:
+    // msvcrt creates it in the drive root, which non-admin users cannot write.
+    static FILE* openSpillFile() {
+#ifdef _WIN32
+        const char* dir = getenv("TEMP");
+        char* path = _tempnam(dir ? dir : ".", "resume");
+        if (!path) return nullptr;
+        FILE* file = fopen(path, "w+bTD");  // T: keep in cache, D: delete on close
+        free(path);
+        return file;
+#else
+        const char* dir = getenv("TMPDIR");
+        string path = string(dir && *dir ? dir : "/tmp") + "/resume-store-XXXXXX";
+        int fd = mkstemp(&path[0]);
+        if (fd < 0) return nullptr;
+        unlink(path.c_str());  // removed as soon as it is closed
+        FILE* file = fdopen(fd, "w+b");
+        if (!file) close(fd);
+        return file;
+#endif
+    }
+
+    bool spill(int position) {
+        if (!spillFile) {
+            spillFile = openSpillFile();
+            spillFileBytes = 0;
+        }
+        if (!spillFile) return false;
+
+        Entry& e = entries[position];
+        if (fseek(spillFile, 0, SEEK_END) != 0) return false;
+        long offset = ftell(spillFile);
+        if (fwrite(e.encoded.data(), 1, e.encoded.size(), spillFile) != e.encoded.size()) return false;
+
+        e.diskOffset = offset;
+        e.diskLength = static_cast<unsigned int>(e.encoded.size());
+        spillFileBytes += e.diskLength;
+        liveSpillBytes += e.diskLength;
+        release(position);
+        return true;
+    }
+
+    // A spilled entry's bytes on disk become dead when it is replaced or restored
+    void discardSpilled(int position) {
+        Entry& e = entries[position];
+        if (e.resident) return;
+        liveSpillBytes -= e.diskLength;
+        e.diskLength = 0;
+    }
+
+    // Rewrites the live spilled entries into a fresh file once more than half
+    // of the current one is dead; drops the file when nothing is spilled
+    void compactSpillFile() {
+        if (!spillFile || spillFileBytes <= 2 * liveSpillBytes) return;
+
+        vector<int> spilled;
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (!entries[i].resident) spilled.push_back(static_cast<int>(i));
+        }
+        if (spilled.empty()) {
+            fclose(spillFile);
+            spillFile = nullptr;
+            spillFileBytes = 0;
+            return;
+        }
+
+        FILE* fresh = openSpillFile();
+        if (!fresh) return;
+        vector<long> offsets;
+        long offset = 0;
+        for (int position : spilled) {
+            const string& bytes = encodedBytes(position);
+            if (fwrite(bytes.data(), 1, bytes.size(), fresh) != bytes.size()) {
+                fclose(fresh);
+                return;  // keep using the old file
+            }
+            offsets.push_back(offset);
+            offset += static_cast<long>(bytes.size());
+        }
+
+        for (size_t i = 0; i < spilled.size(); i++) entries[spilled[i]].diskOffset = offsets[i];
+        fclose(spillFile);
+        spillFile = fresh;
+        spillFileBytes = liveSpillBytes;
+    }
+
+    // Reads spilled entries back into memory while they fit under the budget
+    void restoreWithinBudget() {
+        for (size_t i = 0; i < entries.size(); i++) {
+            Entry& e = entries[i];
+            if (e.resident || residentBytes + e.diskLength > memoryBudget) continue;
+
+            string bytes = encodedBytes(static_cast<int>(i));
+            discardSpilled(static_cast<int>(i));
+            e.encoded = move(bytes);
+            e.resident = true;
+            residentBytes += e.encoded.size();
+            e.lruPosition = residentOrder.insert(residentOrder.begin(), static_cast<int>(i));  // spilled = oldest
+        }
+        compactSpillFile();
+    }
+
+    void enforceBudget() {
+        while (residentBytes > memoryBudget && !residentOrder.empty()) {
+            if (!spill(residentOrder.front())) {
+                cerr << "Resume store: spill file unavailable, keeping entries in memory\n";
+                return;
+            }
+        }
+    }
+
+public:
+    explicit ResumeStore(size_t budgetBytes)
+        : memoryBudget(budgetBytes), residentBytes(0), spillFile(nullptr), spillFileBytes(0), liveSpillBytes(0), 
+          legacyBytes(0) {}
+
+    ResumeStore(const ResumeStore&) = delete;
+    ResumeStore& operator=(const ResumeStore&) = delete;
+
+    ~ResumeStore() {
+        if (spillFile) fclose(spillFile);
+    }
+
+    void clear() {
+        termIds.clear();
+        terms.clear();
+        termHashes.clear();
+        entries.clear();
+        positionOfUser.clear();
+        residentOrder.clear();
+        residentBytes = 0;
+        legacyBytes = 0;
+        if (spillFile) {
+            fclose(spillFile);
+            spillFile = nullptr;
+        }
+        spillFileBytes = 0;
+        liveSpillBytes = 0;
+    }
+
+    // Lowering the budget spills the oldest writes; raising it reads spilled ones back
+    void setMemoryBudget(size_t bytes) {
+        memoryBudget = bytes;
+        enforceBudget();
+        restoreWithinBudget();
+    }
+    size_t getMemoryBudget() const { return memoryBudget; }
+
+    static string makeSnippet(const vector<string>& words) {
+        return words.size() > 5 ? words[0] + " " + words[1] + "..." : "";
+    }
+
+    // Term dictionary
+    int termId(const string& term) const {
+        auto it = termIds.find(term);
+        return it == termIds.end() ? -1 : it->second;
+    }
+    size_t termCount() const { return terms.size(); }
+    const string& term(int id) const { return terms[id]; }
+    unsigned int termHash(int id) const { return termHashes[id]; }
+
+    size_t size() const { return entries.size(); }
+    int find(int userId) const {
+        auto it = positionOfUser.find(userId);
+        return it == positionOfUser.end() ? -1 : it->second;
+    }
+    int userId(int position) const { return entries[position].userId; }
+    int totalWords(int position) const { return entries[position].totalWords; }
+    const string& name(int position) const { return entries[position].name; }
+    const string& snippet(int position) const { return entries[position].snippet; }
+    size_t encodedSize(int position) const {
+        const Entry& e = entries[position];
+        return e.resident ? e.encoded.size() : e.diskLength;
+    }
+
+    // Inserts or replaces a user's resume. Returns its position; `changed` is
+    // false when the stored copy was already identical, otherwise `previous`
+    // receives the postings that were replaced (empty for a new user).
+    int put(int userId, const string& name, const vector<string>& words, 
+            const string& snippet, Postings& previous, bool& changed) {
+        map<int, int> counts;
+        for (const string& w : words) {
+            auto it = termIds.find(w);
+            int id;
+            if (it == termIds.end()) {
+                id = static_cast<int>(terms.size());
+                termIds[w] = id;
+                terms.push_back(w);
+                termHashes.push_back(Utils::hashTerm(w));
+            } else {
+                id = it->second;
+            }
+            counts[id]++;
+        }
+
+        string encoded;
+        int lastId = 0;
+        for (const auto& entry : counts) {
+            appendVarint(encoded, entry.first - lastId);
+            appendVarint(encoded, entry.second);
+            lastId = entry.first;
+        }
+
+        previous.clear();
+        int position = find(userId);
+        if (position >= 0) {
+            Entry& e = entries[position];
+            if (e.name == name && e.snippet == snippet && e.totalWords == static_cast<int>(words.size()) && 
+                encodedBytes(position) == encoded) {
+                changed = false;
+                return position;
+            }
+            decode(position, previous);
+            discardSpilled(position);
+            release(position);
+            legacyBytes -= e.legacyBytes;
+        } else {
+            position = static_cast<int>(entries.size());
+            entries.push_back(Entry());
+            positionOfUser[userId] = position;
+        }
+
+        Entry& e = entries[position];
+        e.legacyBytes = legacyFootprint(words, counts, terms);
+        legacyBytes += e.legacyBytes;
+        e.userId = userId;
+        e.totalWords = static_cast<int>(words.size());
+        e.name = name;
+        e.snippet = snippet;
+        e.encoded = move(encoded);
+        e.resident = true;
+        residentBytes += e.encoded.size();
+        e.lruPosition = residentOrder.insert(residentOrder.end(), position);
+        changed = true;
+
+        enforceBudget();
+        compactSpillFile();
+        return position;
+    }
+
+    void decode(int position, Postings& out) {
+        out.clear();
+        const string& bytes = encodedBytes(position);
+        size_t pos = 0;
+        int id = 0;
+        while (pos < bytes.size()) {
+            id += static_cast<int>(readVarint(bytes, pos));
+            int count = static_cast<int>(readVarint(bytes, pos));
+            out.push_back({id, count});
+        }
+    }
+
+    void printMemoryReport() const {
+        size_t n = entries.size();
+        size_t fixedBytes = 0, postingBytes = residentBytes, spilledBytes = 0, spilledCount = 0;
+        for (const Entry& e : entries) {
+            fixedBytes += sizeof(Entry) + heapBytes(e.name) + heapBytes(e.snippet) + 
+                          sizeof(pair<int, int>) + 16;  // positionOfUser node
+            if (!e.resident) {
+                spilledBytes += e.diskLength;
+                spilledCount++;
+            }
+        }
+        size_t dictionaryBytes = 0;
+        for (const string& t : terms) {
+            dictionaryBytes += sizeof(string) + heapBytes(t) + sizeof(unsigned int) +  // terms, termHashes
+                               sizeof(string) + sizeof(int) + 16 + heapBytes(t);      // termIds node
+        }
+        size_t compactBytes = fixedBytes + postingBytes + dictionaryBytes;
+
+        cout << "\nResume Store Memory Report (" << n << " resumes, " << terms.size() << " distinct terms)\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << fixed << setprecision(1);
+        cout << "Postings memory budget:   " << memoryBudget << " bytes\n";
+        cout << "Resident postings:        " << postingBytes << " bytes\n";
+        cout << "Spilled to disk:          " << spilledCount << " resumes, " << spilledBytes << " bytes\n";
+        cout << "Spill file size:          " << spillFileBytes << " bytes\n";
+        cout << "Term dictionary:          " << dictionaryBytes << " bytes (not budgeted)\n";
+        cout << "Names, snippets, id map:  " << fixedBytes << " bytes (not budgeted)\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << "Bytes/resume before (words x2 + TF map): " << (n ? static_cast<double>(legacyBytes) / n : 0.0) << "\n";
+        cout << "Bytes/resume after (in memory):          " << (n ? static_cast<double>(compactBytes) / n : 0.0) << "\n";
+        cout << "-----------------------------------------------------------------\n";
+    }
+};
+
+// Job Matching Algorithm
+class JobMatcher {
+private:
+    typedef ResumeStore::Postings Postings;
+
+    struct RankedCandidate {
+        string name;
+        string snippet;
+        double score;
+    };
+
+    // Query terms with their IDF weights. Per-term contributions are summed in
+    // term-text order, so a shard scoring with the same global IDF produces
+    // bit-identical scores to a single process despite different term ids.
+    struct WeightedQuery {
+        Postings terms;       // (local term id, occurrences), ascending ids
+        vector<double> idf;   // aligned with terms
+        vector<int> order;    // summation order: indexes into terms by term text
+    };
+
+    Database& db;
+    TextAnalyzer analyzer;       // same pipeline for resumes and queries
+    ResumeStore store;           // store positions double as HNSW labels
+    vector<int> documentFreq;    // by term id
+    vector<double> idf;          // by term id; 0 for terms no resume contains
+    HnswIndex annIndex;
+    bool corpusLoaded;
+    bool graphStale;
+    int efSearch;
+    Postings scratch;
+    vector<double> termScores;
+
+    // Partition of Users handled by this matcher: [shardLow, shardHigh)
+    int shardLow;
+    int shardHigh;
+
+    // Delta sync over Users: the fetcher thread stages analyzed rows past its
+    // watermarks, and syncResumes applies them on the query thread
+    struct StagedResume {
+        int userId;
+        string name;
+        vector<string> words;  // analyzed
+        string snippet;
+        string updatedAt;
+    };
+    thread fetcher;
+    mutex fetcherMutex;
+    condition_variable fetcherWake;
+    bool fetcherStopping;
+    vector<StagedResume> staged;  // guarded by fetcherMutex
+    size_t builtSize;
+    size_t deltasSinceBuild;
+
+    // Background HNSW rebuild (see startGraphRebuild)
+    future<HnswIndex> rebuiltGraph;
+    size_t rebuildSize;
+    vector<int> changedDuringRebuild;
+
+    // Shards coordinated by this matcher, in user_id order
+    struct ShardHandle {
+        int low;                        // user_id range [low, high)
+        int high;
+        int fd;                         // socket to the worker process; -1 for an in-process shard
+        long pid;
+        unique_ptr<Database> localDb;   // in-process shards (Windows has no fork)
+        unique_ptr<JobMatcher> local;
+        string reply;
+    };
+    vector<ShardHandle> shards;
+
+    struct ShardHit {
+        int userId;
+        RankedCandidate candidate;
+    };
+
+    void adjustFrequencies(const Postings& postings, int delta) {
+        if (documentFreq.size() < store.termCount()) documentFreq.resize(store.termCount(), 0);
+        for (const auto& p : postings) documentFreq[p.first] += delta;
+    }
+
+    // Apply IDF formula with smoothing; the sharded coordinator uses it on global counts
+    static double smoothedIDF(double totalDocuments, int documentFrequency) {
+        return log((totalDocuments + 1.0) / (1.0 + documentFrequency)) + 1;
+    }
+
+    void calculateIDF() {
+        double totalDocuments = store.size();
+        idf.assign(store.termCount(), 0.0);
+        for (size_t t = 0; t < idf.size() && t < documentFreq.size(); t++) {
+            if (documentFreq[t] > 0) idf[t] = smoothedIDF(totalDocuments, documentFreq[t]);
+        }
+    }
+
+    void sortByTermText(WeightedQuery& query) {
+        query.order.resize(query.terms.size());
+        for (size_t i = 0; i < query.order.size(); i++) query.order[i] = static_cast<int>(i);
+        sort(query.order.begin(), query.order.end(), [&](int a, int b) {
+            return store.term(query.terms[a].first) < store.term(query.terms[b].first);
+        });
+    }
+
+    // Query words as (term id, occurrences) weighted by this corpus' IDF,
+    // keeping only terms some resume has
+    WeightedQuery weighQuery(const vector<string>& words) {
+        map<int, int> counts;
+        for (const string& w : words) {
+            int id = store.termId(w);
+            if (id >= 0 && idf[id] > 0.0) counts[id]++;
+        }
+
+        WeightedQuery query;
+        query.terms.assign(counts.begin(), counts.end());
+        for (const auto& t : query.terms) query.idf.push_back(idf[t.first]);
+        sortByTermText(query);
+        return query;
+    }
+
+    // Sum of TF-IDF over the query words, counting repeated query words again
+    double calculateTFIDFScore(const Postings& doc, int totalWords, const WeightedQuery& query) {
+        termScores.assign(query.terms.size(), 0.0);
+        size_t i = 0, j = 0;
+        while (i < doc.size() && j < query.terms.size()) {
+            if (doc[i].first < query.terms[j].first) i++;
+            else if (doc[i].first > query.terms[j].first) j++;
+            else {
+                termScores[j] = query.terms[j].second * (static_cast<double>(doc[i].second) / totalWords) * query.idf[j];
+                i++;
+                j++;
+            }
+        }
+
+        double score = 0.0;
+        for (int t : query.order) score += termScores[t];
+        return score;
+    }
+
+    // Cosine similarity of the full (unhashed) TF-IDF vectors
+    double calculateCosine(const Postings& doc, int totalWords, const Postings& query) {
+        double dot = 0.0, docNorm = 0.0, queryNorm = 0.0;
+        for (const auto& p : doc) {
+            double w = static_cast<double>(p.second) / totalWords * idf[p.first];
+            docNorm += w * w;
+        }
+        for (const auto& p : query) {
+            double w = p.second * idf[p.first];
+            queryNorm += w * w;
+        }
+        size_t i = 0, j = 0;
+        while (i < doc.size() && j < query.size()) {
+            if (doc[i].first < query[j].first) i++;
+            else if (doc[i].first > query[j].first) j++;
+            else {
+                dot += (static_cast<double>(doc[i].second) / totalWords) * query[j].second * idf[doc[i].first] * idf[doc[i].first];
+                i++;
+                j++;
+            }
+        }
+        if (docNorm == 0.0 || queryNorm == 0.0) return 0.0;
+        return dot / (sqrt(docNorm) * sqrt(queryNorm));
+    }
+
+    // TF-IDF weights folded into a fixed-width vector with signed feature hashing,
+    // then L2-normalized so that a dot product is a cosine similarity
+    vector<float> hashedVector(const Postings& postings, int totalWords) {
+        vector<float> v(ANN_DIMENSIONS, 0.0f);
+        for (const auto& p : postings) {
+            if (idf[p.first] <= 0.0) continue;
+
+            unsigned int hash = store.termHash(p.first);
+            float weight = static_cast<float>(static_cast<double>(p.second) / totalWords * idf[p.first]);
+            v[hash % ANN_DIMENSIONS] += (hash & 0x80000000u) ? -weight : weight;
+        }
+
+        float norm = 0.0f;
+        for (float x : v) norm += x * x;
+        if (norm > 0.0f) {
+            norm = sqrt(norm);
+            for (float& x : v) x /= norm;
+        }
+        return v;
+    }
+
+    vector<float> documentVector(int position) {
+        store.decode(position, scratch);
+        return hashedVector(scratch, store.totalWords(position));
+    }
+
+    // Users rows of this shard matching `condition`, each tokenized, analyzed
+    // and handed to `sink` as it streams in
+    static bool readResumes(Database& source, const TextAnalyzer& pipeline, int low, int high, 
+                            const string& condition, const function<void(StagedResume&)>& sink) {
+        string query = "SELECT user_id, name, resume, updated_at FROM Users "
+                       "WHERE role='JobSeeker' AND resume IS NOT NULL" + condition;
+        if (low > 0) query += " AND user_id >= " + to_string(low);
+        if (high < numeric_limits<int>::max()) query += " AND user_id < " + to_string(high);
+        MYSQL_RES* res = source.executeQueryWithResult(query);
+        if (!res) return false;
+
+        MYSQL_ROW row;
+        while ((row = mysql_fetch_row(res))) {
+            StagedResume resume;
+            resume.userId = atoi(row[0]);
+            resume.name = row[1];
+            resume.words = Utils::tokenize(row[2]);
+            resume.snippet = ResumeStore::makeSnippet(resume.words);  // display text, before analysis
+            pipeline.apply(resume.words);
+            resume.updatedAt = row[3];
+            sink(resume);
+        }
+        mysql_free_result(res);
+        return true;
+    }
+
+    static string deltaCondition(int lastUserId, const string& watermark) {
+        string condition = " AND (user_id > " + to_string(lastUserId);
+        if (!watermark.empty()) {
+            condition += " OR updated_at >= TIMESTAMPADD(SECOND, -" + to_string(INDEX_REFRESH_OVERLAP_SECONDS) + 
+                         ", '" + watermark + "')";
+        }
+        return condition + ")";
+    }
+
+    // Puts one row into the store; its position is appended to `changed`
+    // unless the content is unchanged (overlap re-read)
+    void applyResume(const StagedResume& resume, vector<int>& changed) {
+        Postings previous;
+        bool contentChanged;
+        int position = store.put(resume.userId, resume.name, resume.words, resume.snippet, previous, contentChanged);
+        if (!contentChanged) return;
+
+        adjustFrequencies(previous, -1);
+        store.decode(position, scratch);
+        adjustFrequencies(scratch, +1);
+        changed.push_back(position);
+    }
+
+    // Background fetcher: polls Users for rows past its own watermarks, with its
+    // own connection and analyzer copy, and stages them for syncResumes
+    void fetchLoop(TextAnalyzer pipeline, int lastUserId, string watermark) {
+        mysql_thread_init();
+        try {
+            Database conn(false);
+            unique_lock<mutex> lock(fetcherMutex);
+            while (!fetcherStopping) {
+                fetcherWake.wait_for(lock, chrono::milliseconds(INDEX_REFRESH_INTERVAL_MS));
+                if (fetcherStopping) break;
+
+                lock.unlock();
+                vector<StagedResume> rows;
+                readResumes(conn, pipeline, shardLow, shardHigh, deltaCondition(lastUserId, watermark), 
+                    [&](StagedResume& resume) {
+                        lastUserId = max(lastUserId, resume.userId);
+                        if (resume.updatedAt > watermark) watermark = resume.updatedAt;
+                        rows.push_back(move(resume));
+                    });
+                lock.lock();
+                for (StagedResume& resume : rows) staged.push_back(move(resume));
+            }
+        } catch (const exception& e) {
+            cerr << "Resume fetcher stopped: " << e.what() << "\n";
+        }
+        mysql_thread_end();
+    }
+
+    void startFetcher(int lastUserId, const string& watermark) {
+        fetcherStopping = false;
+        fetcher = thread(&JobMatcher::fetchLoop, this, analyzer, lastUserId, watermark);
+    }
+
+    // Rows already staged were analyzed for the corpus being replaced, so they are dropped
+    void stopFetcher() {
+        {
+            lock_guard<mutex> lock(fetcherMutex);
+            fetcherStopping = true;
+        }
+        fetcherWake.notify_all();
+        if (fetcher.joinable()) fetcher.join();
+        staged.clear();
+    }
+
+    void loadCorpus() {
+        stopFetcher();
+        discardGraphRebuild();
+        store.clear();
+        documentFreq.clear();
+
+        int lastUserId = 0;
+        string watermark;
+        vector<int> loaded;
+        readResumes(db, analyzer, shardLow, shardHigh, "", [&](StagedResume& resume) {
+            applyResume(resume, loaded);
+            lastUserId = max(lastUserId, resume.userId);
+            if (resume.updatedAt > watermark) watermark = resume.updatedAt;
+        });
+        calculateIDF();
+        corpusLoaded = true;
+        graphStale = true;
+        startFetcher(lastUserId, watermark);
+    }
+
+    // The HNSW graph is only built when an approximate search needs it
+    void ensureGraph() {
+        if (!graphStale) return;
+        discardGraphRebuild();
+        annIndex.clear();
+        for (size_t i = 0; i < store.size(); i++) {
+            annIndex.add(static_cast<int>(i), documentVector(static_cast<int>(i)));
+        }
+        builtSize = store.size();
+        deltasSinceBuild = 0;
+        graphStale = false;
+    }
+
+    // Runs on a worker thread over vectors taken with the IDF of the moment;
+    // row i is store position i
+    static HnswIndex buildGraph(const vector<float>& vectors) {
+        HnswIndex index(ANN_DIMENSIONS, ANN_M, ANN_EF_CONSTRUCTION);
+        vector<float> v(ANN_DIMENSIONS);
+        for (size_t i = 0; (i + 1) * ANN_DIMENSIONS <= vectors.size(); i++) {
+            copy(vectors.begin() + i * ANN_DIMENSIONS, vectors.begin() + (i + 1) * ANN_DIMENSIONS, v.begin());
+            index.add(static_cast<int>(i), v);
+        }
+        return index;
+    }
+
+    // Only the O(N) vector snapshot happens here; the O(N log N) inserts run in
+    // the background while searches keep using the current graph
+    void startGraphRebuild() {
+        vector<float> vectors;
+        vectors.reserve(store.size() * ANN_DIMENSIONS);
+        for (size_t i = 0; i < store.size(); i++) {
+            vector<float> v = documentVector(static_cast<int>(i));
+            vectors.insert(vectors.end(), v.begin(), v.end());
+        }
+        rebuildSize = store.size();
+        changedDuringRebuild.clear();
+        rebuiltGraph = async(launch::async, &JobMatcher::buildGraph, move(vectors));
+    }
+
+    // Swaps in a finished rebuild, replaying the positions that changed meanwhile
+    void adoptRebuiltGraph() {
+        if (!rebuiltGraph.valid() || rebuiltGraph.wait_for(chrono::seconds(0)) != future_status::ready) return;
+        annIndex = rebuiltGraph.get();
+        for (int position : changedDuringRebuild) {
+            annIndex.add(position, documentVector(position));
+        }
+        changedDuringRebuild.clear();
+        builtSize = rebuildSize;
+        deltasSinceBuild = 0;
+    }
+
+    void discardGraphRebuild() {
+        if (rebuiltGraph.valid()) rebuiltGraph.wait();
+        rebuiltGraph = future<HnswIndex>();
+        changedDuringRebuild.clear();
+    }
+
+    // Applies resumes registered or edited since the watermarks (by this or any
+    // other instance) to the live store and graph instead of reloading them.
+    // The rows are read and analyzed by the background fetcher, so a search
+    // only pays for the store updates and HNSW inserts of what is staged.
+    // Vectors already in the graph keep the IDF they were built with; once the
+    // deltas exceed a quarter of the corpus a new graph is built in the
+    // background to remove that drift and swapped in by a later search.
+    void syncResumes() {
+        if (!corpusLoaded) {
+            loadCorpus();
+            return;
+        }
+
+        adoptRebuiltGraph();
+        vector<StagedResume> rows;
+        {
+            lock_guard<mutex> lock(fetcherMutex);
+            rows.swap(staged);
+        }
+        fetcherWake.notify_one();  // fetch the next delta now instead of at the next poll
+
+        vector<int> changed;
+        for (const StagedResume& resume : rows) applyResume(resume, changed);
+        if (changed.empty()) return;
+
+        calculateIDF();
+        if (graphStale) return;
+
+        for (int position : changed) {
+            annIndex.add(position, documentVector(position));
+        }
+        if (rebuiltGraph.valid()) {
+            changedDuringRebuild.insert(changedDuringRebuild.end(), changed.begin(), changed.end());
+            return;
+        }
+        deltasSinceBuild += changed.size();
+        if (deltasSinceBuild * 4 > builtSize) startGraphRebuild();
+    }
+
+    // (store position, score), best first; ties go to the lower user_id so that
+    // merged shard results come out in the same order
+    vector<pair<int, double>> exactRanking(const WeightedQuery& query) {
+        vector<pair<int, double>> ranked;
+        ranked.reserve(store.size());
+        for (size_t i = 0; i < store.size(); i++) {
+            int position = static_cast<int>(i);
+            store.decode(position, scratch);
+            ranked.push_back({position, calculateTFIDFScore(scratch, store.totalWords(position), query)});
+        }
+        sort(ranked.begin(), ranked.end(), 
+            [this](const pair<int, double>& a, const pair<int, double>& b) {
+                if (a.second != b.second) return a.second > b.second;
+                return store.userId(a.first) < store.userId(b.first);
+            });
+        return ranked;
+    }
+
+    vector<RankedCandidate> fromStore(const vector<pair<int, double>>& ranked) {
+        vector<RankedCandidate> candidates;
+        for (size_t i = 0; i < ranked.size() && i < 10; ++i) {
+            candidates.push_back(RankedCandidate{store.name(ranked[i].first), store.snippet(ranked[i].first), 
+                                                 ranked[i].second});
+        }
+        return candidates;
+    }
+
+    void printRanking(const vector<RankedCandidate>& ranked) {
+        cout << "\nTop Matching Candidates:\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << left << setw(5) << "Rank" << setw(20) << "Candidate" << setw(15) << "Score" << "Resume Excerpt\n";
+        cout << "-----------------------------------------------------------------\n";
+        
+        for (size_t i = 0; i < ranked.size() && i < 10; ++i) {
+            cout << left << setw(5) << i+1 
+                 << setw(20) << ranked[i].name 
+                 << setw(15) << fixed << setprecision(3) << ranked[i].score
+                 << ranked[i].snippet << "\n";
+        }
+        cout << "-----------------------------------------------------------------\n";
+    }
+
+    // Set of ids among the top k with a non-zero score
+    static vector<int> topPositives(const vector<pair<int, double>>& ranked, size_t k) {
+        vector<int> top;
+        for (size_t i = 0; i < ranked.size() && top.size() < k; i++) {
+            if (ranked[i].second <= 0.0) break;
+            top.push_back(ranked[i].first);
+        }
+        sort(top.begin(), top.end());
+        return top;
+    }
+
+    static double recallOf(const vector<pair<int, double>>& approx, const vector<int>& truth) {
+        size_t found = 0;
+        for (const auto& hit : approx) {
+            if (binary_search(truth.begin(), truth.end(), hit.first)) found++;
+        }
+        return static_cast<double>(found) / truth.size();
+    }
+
+    static double elapsedMs(chrono::steady_clock::time_point start) {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
+
+    // Posted jobs serve as benchmark queries; sampleQuery is used when there are none
+    vector<string> loadBenchmarkQueries(const string& sampleQuery) {
+        vector<string> queries;
+        MYSQL_RES* res = db.executeQueryWithResult("SELECT title, description, skills_required FROM Jobs LIMIT 100");
+        if (res) {
+            MYSQL_ROW row;
+            while ((row = mysql_fetch_row(res))) {
+                queries.push_back(string(row[0]) + " " + row[1] + " " + row[2]);
+            }
+            mysql_free_result(res);
+        }
+        if (queries.empty()) queries.push_back(sampleQuery);
+        return queries;
+    }
+
+    // Ranks inside MySQL with the ft_users_resume FULLTEXT index; only the top
+    // k rows (id, name, score and a short prefix for the snippet) come back
+    bool fullTextRanking(const string& jobDescription, size_t k, 
+                         vector<int>& userIds, vector<RankedCandidate>& ranked) {
+        string against = "AGAINST('" + db.escape(jobDescription) + "' IN NATURAL LANGUAGE MODE)";
+        string query = "SELECT user_id, name, LEFT(resume, 120), MATCH(resume) " + against + " AS score "
+                       "FROM Users WHERE role='JobSeeker' AND MATCH(resume) " + against + 
+                       " ORDER BY score DESC LIMIT " + to_string(k);
+
+        MYSQL_RES* res = db.executeQueryWithResult(query);
+        if (!res) return false;
+
+        MYSQL_ROW row;
+        while ((row = mysql_fetch_row(res))) {
+            userIds.push_back(atoi(row[0]));
+            ranked.push_back(RankedCandidate{row[1], ResumeStore::makeSnippet(Utils::tokenize(row[2] ? row[2] : "")), 
+                                             atof(row[3])});
+        }
+        mysql_free_result(res);
+        return true;
+    }
+
+    static string exactDouble(double value) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.17g", value);  // round-trips through strtod
+        return buffer;
     }
 
-    void updateResume(Database& db, const string& newResume) {
-        if (!logged_in) {
-            cerr << "You must be logged in to update your resume\n";
-            return;
+    static vector<string> splitFields(const string& text, char separator) {
+        vector<string> fields;
+        size_t start = 0;
+        while (true) {
+            size_t end = text.find(separator, start);
+            fields.push_back(text.substr(start, end - start));
+            if (end == string::npos) break;
+            start = end + 1;
         }
+        return fields;
+    }
 
-        string query = "UPDATE Users SET resume = '" + Utils::trim(newResume) + 
-                      "' WHERE user_id = " + to_string(user_id);
-        
-        if (db.executeQuery(query)) {
-            resume = newResume;
-            cout << "Resume updated successfully\n";
-        }
+    // Names are free text; tabs and newlines would break the reply lines
+    static string wireSafe(string text) {
+        replace(text.begin(), text.end(), '\t', ' ');
+        replace(text.begin(), text.end(), '\n', ' ');
+        return text;
     }
 
-    bool isLoggedIn() const { return logged_in; }
-    string getRole() const { return role; }
-    int getUserId() const { return user_id; }
-    string getName() const { return name; }
-    string getResume() const { return resume; }
-};
+#ifndef _WIN32
+    // Worker sockets carry frames of a 4-byte host-order length followed by the payload
+    static bool sendFrame(int fd, const string& payload) {
+#ifdef MSG_NOSIGNAL
+        const int flags = MSG_NOSIGNAL;  // a dead worker shows up as an error, not SIGPIPE
+#else
+        const int flags = 0;             // SO_NOSIGPIPE is set on the socket instead (macOS)
+#endif
+        uint32_t length = static_cast<uint32_t>(payload.size());
+        string frame(reinterpret_cast<const char*>(&length), sizeof(length));
+        frame += payload;
+
+        size_t sent = 0;
+        while (sent < frame.size()) {
+            ssize_t n = send(fd, frame.data() + sent, frame.size() - sent, flags);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            sent += n;
+        }
+        return true;
+    }
 
-// Job Management
-class JobManager {
-private:
-    Database& db;
+    // Waits for the whole buffer, or gives up at the deadline when one is given
+    static bool receiveAll(int fd, char* data, size_t length, const chrono::steady_clock::time_point* deadline) {
+        while (length > 0) {
+            if (deadline) {
+                long long remaining = chrono::duration_cast<chrono::milliseconds>(
+                    *deadline - chrono::steady_clock::now()).count();
+                pollfd ready = {fd, POLLIN, 0};
+                int polled = remaining > 0 ? poll(&ready, 1, static_cast<int>(remaining)) : 0;
+                if (polled < 0 && errno == EINTR) continue;
+                if (polled <= 0) return false;
+            }
+            ssize_t n = recv(fd, data, length, 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            data += n;
+            length -= n;
+        }
+        return true;
+    }
 
-public:
-    JobManager(Database& database) : db(database) {}
-
-    bool postJob(int recruiter_id, const string& title, const string& description, 
-                const string& location, const string& skills, int salary) {
-        string query = "INSERT INTO Jobs (recruiter_id, title, description, location, skills_required, salary) VALUES (" +
-                      to_string(recruiter_id) + ", '" + Utils::trim(title) + "', '" + 
-                      Utils::trim(description) + "', '" + Utils::trim(location) + "', '" + 
-                      Utils::trim(skills) + "', " + to_string(salary) + ")";
-        
-        return db.executeQuery(query);
+    static bool receiveFrame(int fd, string& payload, const chrono::steady_clock::time_point* deadline = nullptr) {
+        uint32_t length;
+        if (!receiveAll(fd, reinterpret_cast<char*>(&length), sizeof(length), deadline)) return false;
+        payload.resize(length);
+        return length == 0 || receiveAll(fd, &payload[0], length, deadline);
     }
 
-    void displayAllJobs() {
-        string query = "SELECT j.job_id, j.title, j.location, j.salary, u.name FROM Jobs j "
-                       "JOIN Users u ON j.recruiter_id = u.user_id";
-        
-        MYSQL_RES* res = db.executeQueryWithResult(query);
-        if (!res) return;
+    static string& workerExecutable() {
+        static string path;
+        return path;
+    }
 
-        cout << "\nAvailable Jobs:\n";
-        cout << "-----------------------------------------------------------------\n";
-        cout << left << setw(5) << "ID" << setw(25) << "Title" << setw(20) << "Location" 
-             << setw(10) << "Salary" << setw(20) << "Recruiter" << "\n";
-        cout << "-----------------------------------------------------------------\n";
+    // Starts a worker process for users [low, high) on one end of a Unix socket
+    // pair. The child execs this program again rather than running on after
+    // fork(): locks held by the app's other threads would be inherited unowned.
+    bool launchWorker(int low, int high) {
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) return false;
+        fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+#if !defined(MSG_NOSIGNAL) && defined(SO_NOSIGPIPE)
+        // No per-send flag here: a write to a dead peer must not raise SIGPIPE
+        int noSigPipe = 1;
+        setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+        setsockopt(fds[1], SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+        // Everything the child uses is prepared before fork()
+        const AnalyzerOptions& options = analyzer.getOptions();
+        string flags;
+        flags += options.expandSynonyms ? '1' : '0';
+        flags += options.removeStopwords ? '1' : '0';
+        flags += options.stem ? '1' : '0';
+        string program = workerExecutable().empty() ? "job_recruitment" : workerExecutable();
+        vector<string> args = {program, SHARD_WORKER_FLAG, to_string(fds[1]), to_string(low), to_string(high), 
+                               flags, to_string(store.getMemoryBudget())};
+        vector<char*> argv;
+        for (string& arg : args) argv.push_back(&arg[0]);
+        argv.push_back(nullptr);
+        long maxFd = sysconf(_SC_OPEN_MAX);
+        if (maxFd < 0 || maxFd > 65536) maxFd = 65536;
+
+        pid_t pid = fork();
+        if (pid == 0) {
+            // Drop inherited MySQL connections and the other workers' sockets
+            for (int fd = 3; fd < maxFd; fd++) {
+                if (fd != fds[1]) close(fd);
+            }
+            execv("/proc/self/exe", argv.data());
+            execvp(argv[0], argv.data());
+            _exit(127);
+        }
 
-        MYSQL_ROW row;
-        while ((row = mysql_fetch_row(res))) {
-            cout << left << setw(5) << row[0] << setw(25) << (strlen(row[1]) > 20 ? string(row[1]).substr(0, 17) + "..." : row[1])
-                 << setw(20) << row[2] << setw(10) << row[3] << setw(20) << row[4] << "\n";
+        close(fds[1]);
+        if (pid < 0) {
+            close(fds[0]);
+            return false;
         }
-        cout << "-----------------------------------------------------------------\n";
-        mysql_free_result(res);
+        shards.push_back(ShardHandle{low, high, fds[0], static_cast<long>(pid), nullptr, nullptr, ""});
+        return true;
+    }
+#endif
+
+    // A shard served by a matcher inside this process, over its own connection
+    bool launchInProcess(int low, int high) {
+        ShardHandle shard{low, high, -1, 0, unique_ptr<Database>(new Database(false)), nullptr, ""};
+        shard.local.reset(new JobMatcher(*shard.localDb, low, high));
+        shard.local->setAnalyzerOptions(analyzer.getOptions());
+        shard.local->setMemoryBudget(store.getMemoryBudget());
+        shards.push_back(move(shard));
+        return true;
     }
-};
 
-// Job Search using Trie
-class JobSearchEngine {
-private:
-    struct TrieNode {
-        TrieNode* children[26] = {nullptr};
-        vector<int> jobIds;
-        
-        ~TrieNode() {
-            for (int i = 0; i < 26; i++) {
-                delete children[i];
+    // Missing a reply (timeout or dead worker) stops every worker; the next
+    // sharded search starts a fresh set
+    bool shardFailed(const ShardHandle& shard) {
+        cerr << "Shard worker for users [" << shard.low << ", " << shard.high << ") is not responding\n";
+#ifndef _WIN32
+        if (!shard.local) kill(static_cast<pid_t>(shard.pid), SIGKILL);
+#endif
+        stopShards();
+        return false;
+    }
+
+    // Sends the request to every shard before collecting any reply, so the
+    // workers run in parallel; replies come back in shard order
+    bool broadcast(const string& request, vector<string>& replies) {
+        replies.assign(shards.size(), "");
+        for (ShardHandle& shard : shards) {
+            if (shard.local) {
+                shard.reply = shard.local->handleShardRequest(request);
+                continue;
             }
+#ifndef _WIN32
+            if (!sendFrame(shard.fd, request)) return shardFailed(shard);
+#endif
         }
-    };
-
-    TrieNode* root;
-    Database& db;
-
-    // Private methods
-    void clearTrie(TrieNode* node) {
-        if (!node) return;
-        for (int i = 0; i < 26; i++) {
-            clearTrie(node->children[i]);
+        auto deadline = chrono::steady_clock::now() + chrono::milliseconds(SHARD_REPLY_TIMEOUT_MS);
+        for (size_t i = 0; i < shards.size(); i++) {
+            if (shards[i].local) {
+                replies[i].swap(shards[i].reply);
+                continue;
+            }
+#ifndef _WIN32
+            if (!receiveFrame(shards[i].fd, replies[i], &deadline)) return shardFailed(shards[i]);
+#endif
         }
-        delete node;
+        return true;
     }
 
-    void insertJob(const string& title, int jobId) {
-        TrieNode* node = root;
-        for (char ch : title) {
-            ch = tolower(ch);
-            if (ch < 'a' || ch > 'z') continue;
-            
-            if (!node->children[ch - 'a']) {
-                node->children[ch - 'a'] = new TrieNode();
+    // Scatter-gather ranking. Document counts are gathered first so every shard
+    // weighs the query with the IDF a single process over all resumes would use;
+    // each shard then returns its local top k and the merge keeps the best k.
+    bool shardedRanking(const string& jobDescription, size_t k, vector<ShardHit>& hits) {
+        map<string, int> occurrences;
+        for (const string& w : analyzer.analyze(jobDescription)) occurrences[w]++;
+
+        string statsRequest = "STATS";
+        for (const auto& term : occurrences) statsRequest += "\t" + term.first;
+        vector<string> replies;
+        if (!broadcast(statsRequest, replies)) return false;
+
+        double totalDocuments = 0.0;
+        vector<int> documentFrequency(occurrences.size(), 0);
+        for (const string& reply : replies) {
+            vector<string> fields = splitFields(reply, '\t');
+            totalDocuments += atoi(fields[0].c_str());
+            for (size_t t = 0; t < documentFrequency.size() && t + 1 < fields.size(); t++) {
+                documentFrequency[t] += atoi(fields[t + 1].c_str());
+            }
+        }
+
+        // Terms no resume contains are dropped, as weighQuery does
+        string rankRequest = "RANK\t" + to_string(k);
+        size_t t = 0;
+        for (const auto& term : occurrences) {
+            if (documentFrequency[t] > 0) {
+                rankRequest += "\t" + term.first + "\t" + to_string(term.second) + "\t" + 
+                               exactDouble(smoothedIDF(totalDocuments, documentFrequency[t]));
+            }
+            t++;
+        }
+        if (!broadcast(rankRequest, replies)) return false;
+
+        hits.clear();
+        for (const string& reply : replies) {
+            for (const string& line : splitFields(reply, '\n')) {
+                vector<string> fields = splitFields(line, '\t');
+                if (fields.size() < 4) continue;
+                hits.push_back(ShardHit{atoi(fields[0].c_str()), 
+                                        RankedCandidate{fields[2], fields[3], strtod(fields[1].c_str(), nullptr)}});
             }
-            node = node->children[ch - 'a'];
         }
-        node->jobIds.push_back(jobId);
+        sort(hits.begin(), hits.end(), [](const ShardHit& a, const ShardHit& b) {
+            if (a.candidate.score != b.candidate.score) return a.candidate.score > b.candidate.score;
+            return a.userId < b.userId;
+        });
+        if (hits.size() > k) hits.resize(k);
+        return true;
     }
 
 public:
-    // Constructor
-    explicit JobSearchEngine(Database& database) : db(database), root(new TrieNode()) {
-        loadJobsFromDatabase();
+    // A matcher restricted to user_id in [shardLowId, shardHighId) serves one shard
+    JobMatcher(Database& database, int shardLowId = 0, int shardHighId = numeric_limits<int>::max()) 
+        : db(database), 
+          store(RESUME_STORE_MEMORY_BUDGET),
+          annIndex(ANN_DIMENSIONS, ANN_M, ANN_EF_CONSTRUCTION), 
+          corpusLoaded(false), 
+          graphStale(true), 
+          efSearch(ANN_EF_SEARCH),
+          shardLow(shardLowId),
+          shardHigh(shardHighId),
+          fetcherStopping(false),
+          builtSize(0),
+          deltasSinceBuild(0),
+          rebuildSize(0) {}
+
+    // Owns running threads; neither copyable nor movable
+    JobMatcher(const JobMatcher&) = delete;
+    JobMatcher& operator=(const JobMatcher&) = delete;
+
+    ~JobMatcher() {
+        stopShards();
+        stopFetcher();
+        discardGraphRebuild();
     }
 
-    // Delete copy constructor and assignment operator
-    JobSearchEngine(const JobSearchEngine&) = delete;
-    JobSearchEngine& operator=(const JobSearchEngine&) = delete;
+    void setSearchEf(int ef) { efSearch = max(ef, 1); }
+    int getSearchEf() const { return efSearch; }
 
-    // Move constructor
-    JobSearchEngine(JobSearchEngine&& other) noexcept 
-        : db(other.db), root(other.root) {
-        other.root = nullptr;
+    // Resumes must be re-analyzed, so the corpus is reloaded on next use
+    void setAnalyzerOptions(const AnalyzerOptions& options) {
+        analyzer.setOptions(options);
+        corpusLoaded = false;
+        // Workers analyze their shards with the same pipeline
+        if (!shards.empty()) startShards(static_cast<int>(shards.size()));
     }
+    const AnalyzerOptions& getAnalyzerOptions() const { return analyzer.getOptions(); }
 
-    // Move assignment operator
-    JobSearchEngine& operator=(JobSearchEngine&& other) noexcept {
-        if (this != &other) {
-            clearTrie(root);
-            root = other.root;
-            other.root = nullptr;
-        }
-        return *this;
+    // Each worker holds its shard under the same budget, so running workers restart with it
+    void setMemoryBudget(size_t bytes) {
+        store.setMemoryBudget(bytes);
+        if (!shards.empty()) startShards(static_cast<int>(shards.size()));
     }
+    size_t getMemoryBudget() const { return store.getMemoryBudget(); }
 
-    // Destructor
-    ~JobSearchEngine() {
-        clearTrie(root);
+    void printMemoryReport() {
+        syncResumes();
+        store.printMemoryReport();
     }
 
-    // Public interface
-    void loadJobsFromDatabase() {
-        clearTrie(root);
-        root = new TrieNode();
-        
-        string query = "SELECT job_id, title FROM Jobs";
-        MYSQL_RES* res = db.executeQueryWithResult(query);
-        if (!res) return;
+    void rankResumes(const string& jobDescription) {
+        syncResumes();
 
-        MYSQL_ROW row;
-        while ((row = mysql_fetch_row(res))) {
-            int jobId = atoi(row[0]);
-            string title = row[1];
-            insertJob(title, jobId);
+        if (store.size() == 0) {
+            cout << "No resumes found in the database\n";
+            return;
         }
-        mysql_free_result(res);
+
+        // Compute and sort TF-IDF scores for each resume
+        printRanking(fromStore(exactRanking(weighQuery(analyzer.analyze(jobDescription)))));
     }
 
-    void searchJobs(const string& prefix) {
-        TrieNode* node = root;
-        for (char ch : prefix) {
-            ch = tolower(ch);
-            if (ch < 'a' || ch > 'z') continue;
-            
-            if (!node->children[ch - 'a']) {
-                cout << "No jobs found with this prefix\n";
-                return;
-            }
-            node = node->children[ch - 'a'];
+    // Cosine-similarity ranking answered from the HNSW index instead of a full scan
+    void rankResumesApprox(const string& jobDescription) {
+        syncResumes();
+
+        if (store.size() == 0) {
+            cout << "No resumes found in the database\n";
+            return;
         }
 
-        if (node->jobIds.empty()) {
-            cout << "No jobs found with this prefix\n";
+        ensureGraph();
+        vector<string> jobWords = analyzer.analyze(jobDescription);
+        vector<float> queryVector = hashedVector(weighQuery(jobWords).terms, max<int>(jobWords.size(), 1));
+        printRanking(fromStore(annIndex.search(queryVector, ANN_TOP_K, efSearch)));
+    }
+
+    // Pushes the ranking down to MySQL (MATCH ... AGAINST on the FULLTEXT index)
+    void rankResumesFullText(const string& jobDescription) {
+        vector<int> userIds;
+        vector<RankedCandidate> ranked;
+        if (!fullTextRanking(jobDescription, FULLTEXT_TOP_K, userIds, ranked)) {
+            cerr << "Full-text search failed\n";
+            return;
+        }
+        if (ranked.empty()) {
+            cout << "No matching resumes found\n";
             return;
         }
+        printRanking(ranked);
+    }
 
-        cout << "\nMatching Jobs:\n";
-        cout << "----------------------------------------\n";
-        for (int jobId : node->jobIds) {
-            string query = "SELECT j.title, j.location, j.salary, u.name FROM Jobs j "
-                          "JOIN Users u ON j.recruiter_id = u.user_id "
-                          "WHERE j.job_id = " + to_string(jobId);
-            
-            MYSQL_RES* res = db.executeQueryWithResult(query);
-            if (res) {
-                MYSQL_ROW row = mysql_fetch_row(res);
-                if (row) {
-                    cout << "ID: " << jobId << " | Title: " << row[0] 
-                         << " | Location: " << row[1] 
-                         << " | Salary: " << row[2] 
-                         << " | Recruiter: " << row[3] << "\n";
-                }
-                mysql_free_result(res);
-            }
+    // Scatter-gather ranking across the shard workers (started on first use);
+    // scores are identical to rankResumes on the whole corpus
+    void rankResumesSharded(const string& jobDescription) {
+        if (shards.empty() && !startShards(SHARD_DEFAULT_WORKERS)) return;
+
+        vector<ShardHit> hits;
+        if (!shardedRanking(jobDescription, SHARD_TOP_K, hits)) return;
+        if (hits.empty()) {
+            cout << "No resumes found in the database\n";
+            return;
         }
-        cout << "----------------------------------------\n";
+
+        vector<RankedCandidate> ranked;
+        for (const ShardHit& hit : hits) ranked.push_back(hit.candidate);
+        printRanking(ranked);
     }
-};
 
-// Job Matching Algorithm
-class JobMatcher {
-private:
-    Database& db;
+    // Splits job seekers with a resume into `count` user_id ranges holding equal
+    // numbers of resumes and starts one worker per range. The last range is open
+    // ended, so users registered later land in it.
+    bool startShards(int count) {
+        stopShards();
 
-    map<string, double> calculateTF(const vector<string>& words) {
-        map<string, double> tf;
-        int totalWords = words.size();
-        
-        for (const string& word : words) {
-            tf[word]++;
+        MYSQL_RES* res = db.executeQueryWithResult(
+            "SELECT user_id FROM Users WHERE role='JobSeeker' AND resume IS NOT NULL ORDER BY user_id");
+        if (!res) return false;
+        vector<int> ids;
+        MYSQL_ROW row;
+        while ((row = mysql_fetch_row(res))) ids.push_back(atoi(row[0]));
+        mysql_free_result(res);
+
+        vector<int> bounds(1, 0);
+        for (int i = 1; i < count; i++) {
+            size_t at = ids.size() * i / count;
+            if (at < ids.size() && ids[at] > bounds.back()) bounds.push_back(ids[at]);
         }
-        
-        // Normalize TF values
-        for (auto &entry : tf) {
-            entry.second /= totalWords;
+        bounds.push_back(numeric_limits<int>::max());
+
+        for (size_t i = 0; i + 1 < bounds.size(); i++) {
+            bool started;
+            try {
+#ifdef _WIN32
+                started = launchInProcess(bounds[i], bounds[i + 1]);
+#else
+                started = launchWorker(bounds[i], bounds[i + 1]);
+#endif
+            } catch (const exception& e) {
+                cerr << e.what() << "\n";
+                started = false;
+            }
+            if (!started) {
+                cerr << "Failed to start shard worker for users [" << bounds[i] << ", " << bounds[i + 1] << ")\n";
+                stopShards();
+                return false;
+            }
         }
-
-        return tf;
+        return true;
     }
 
-    map<string, double> calculateIDF(const vector<vector<string>>& allResumes) {
-        map<string, double> idf;
-        int totalDocuments = allResumes.size();
-        
-        for (const auto& resume : allResumes) {
-            map<string, bool> seen;
-            for (const string& word : resume) {
-                if (!seen[word]) {
-                    idf[word]++;
-                    seen[word] = true;
+    // Workers get SHARD_EXIT_GRACE_MS to exit after QUIT; one still busy (for
+    // example on a slow query) is killed so the UI never waits on it
+    void stopShards() {
+#ifndef _WIN32
+        for (ShardHandle& shard : shards) {
+            if (shard.fd < 0) continue;
+            sendFrame(shard.fd, "QUIT");
+            close(shard.fd);
+        }
+        auto deadline = chrono::steady_clock::now() + chrono::milliseconds(SHARD_EXIT_GRACE_MS);
+        for (ShardHandle& shard : shards) {
+            if (shard.fd < 0) continue;
+            pid_t pid = static_cast<pid_t>(shard.pid);
+            while (waitpid(pid, nullptr, WNOHANG) == 0) {
+                if (chrono::steady_clock::now() >= deadline) {
+                    kill(pid, SIGKILL);
+                    waitpid(pid, nullptr, 0);
+                    break;
                 }
+                this_thread::sleep_for(chrono::milliseconds(10));
             }
         }
+#endif
+        shards.clear();
+    }
+
+    size_t shardCount() const { return shards.size(); }
 
-        // Apply IDF formula with smoothing
-        for (auto &entry : idf) {
-            entry.second = log((totalDocuments + 1.0) / (1.0 + entry.second)) + 1;
+    void printShards() const {
+        if (shards.empty()) {
+            cout << "No shard workers running\n";
+            return;
+        }
+        for (size_t i = 0; i < shards.size(); i++) {
+            cout << "Shard " << i + 1 << ": users [" << shards[i].low << ", " 
+                 << (shards[i].high == numeric_limits<int>::max() ? string("end") : to_string(shards[i].high)) << ") "
+                 << (shards[i].local ? string("in-process") : "pid " + to_string(shards[i].pid)) << "\n";
         }
+    }
 
-        return idf;
+    // Worker side of sharded ranking; one reply per request:
+    //   STATS\t<term>...                                -> <resumes>\t<df>...
+    //   RANK\t<k>[\t<term>\t<occurrences>\t<idf>]...    -> "<user_id>\t<score>\t<name>\t<snippet>" lines
+    // STATS also applies resume deltas, so the RANK that follows sees the same corpus
+    string handleShardRequest(const string& request) {
+        vector<string> fields = splitFields(request, '\t');
+        string reply;
+
+        if (fields[0] == "STATS") {
+            syncResumes();
+            reply = to_string(store.size());
+            for (size_t i = 1; i < fields.size(); i++) {
+                int id = store.termId(fields[i]);
+                int frequency = id >= 0 && id < static_cast<int>(documentFreq.size()) ? documentFreq[id] : 0;
+                reply += "\t" + to_string(frequency);
+            }
+        } else if (fields[0] == "RANK" && fields.size() >= 2) {
+            // Global IDF from the coordinator; terms this shard never saw score zero
+            map<int, pair<int, double>> weights;
+            for (size_t i = 2; i + 2 < fields.size(); i += 3) {
+                int id = store.termId(fields[i]);
+                if (id >= 0) weights[id] = {atoi(fields[i + 1].c_str()), strtod(fields[i + 2].c_str(), nullptr)};
+            }
+            WeightedQuery query;
+            for (const auto& w : weights) {
+                query.terms.push_back({w.first, w.second.first});
+                query.idf.push_back(w.second.second);
+            }
+            sortByTermText(query);
+
+            vector<pair<int, double>> ranked = exactRanking(query);
+            size_t k = strtoul(fields[1].c_str(), nullptr, 10);
+            for (size_t i = 0; i < ranked.size() && i < k; i++) {
+                int position = ranked[i].first;
+                reply += to_string(store.userId(position)) + "\t" + exactDouble(ranked[i].second) + "\t" + 
+                         wireSafe(store.name(position)) + "\t" + wireSafe(store.snippet(position)) + "\n";
+            }
+        }
+        return reply;
     }
 
-    double calculateTFIDFScore(const map<string, double>& tf, 
-                             const map<string, double>& idf, 
-                             const vector<string>& jobDescription) {
-        double score = 0.0;
-        for (const string& word : jobDescription) {
-            auto tfIt = tf.find(word);
-            auto idfIt = idf.find(word);
-            
-            if (tfIt != tf.end() && idfIt != idf.end()) {
-                score += tfIt->second * idfIt->second;
+#ifndef _WIN32
+    // Shard workers re-exec this program; argv[0] is the fallback where /proc/self/exe is missing
+    static void setWorkerExecutable(const string& path) { workerExecutable() = path; }
+
+    // Entry point of a process started by launchWorker:
+    //   <program> SHARD_WORKER_FLAG <socket fd> <low> <high> <analyzer flags> <memory budget>
+    static int runShardWorker(int argc, char* argv[]) {
+        if (argc < 7) {
+            cerr << "Usage: " << argv[0] << " " << SHARD_WORKER_FLAG 
+                 << " <fd> <low user_id> <high user_id> <analyzer flags> <memory budget>\n";
+            return 2;
+        }
+
+        int fd = atoi(argv[2]);
+        string flags = argv[5];
+        int status = 0;
+        try {
+            Database database(false);
+            JobMatcher shard(database, atoi(argv[3]), atoi(argv[4]));
+            AnalyzerOptions options;
+            options.expandSynonyms = flags.size() > 0 && flags[0] == '1';
+            options.removeStopwords = flags.size() > 1 && flags[1] == '1';
+            options.stem = flags.size() > 2 && flags[2] == '1';
+            shard.setAnalyzerOptions(options);
+            shard.setMemoryBudget(strtoull(argv[6], nullptr, 10));
+
+            string request;
+            while (receiveFrame(fd, request) && request != "QUIT") {
+                if (!sendFrame(fd, shard.handleShardRequest(request))) break;
             }
+        } catch (const exception& e) {
+            cerr << "Shard worker error: " << e.what() << endl;
+            status = 1;
         }
-        return score;
+        close(fd);
+        return status;
     }
+#endif
 
-public:
-    JobMatcher(Database& database) : db(database) {}
+    // Measures ANN recall@K and latency against exact rankings
+    void benchmarkRecall(const string& sampleQuery) {
+        vector<string> queries = loadBenchmarkQueries(sampleQuery);
 
-    void rankResumes(const string& jobDescription) {
-        vector<vector<string>> allResumes;
-        vector<string> jobWords = Utils::tokenize(jobDescription);
-        vector<pair<int, double>> rankedResumes;
+        syncResumes();
+        graphStale = true;
+        auto start = chrono::steady_clock::now();
+        ensureGraph();
+        double buildMs = elapsedMs(start);
 
-        // Fetch all resumes from the database
-        string query = "SELECT user_id, name, resume FROM Users WHERE role='JobSeeker' AND resume IS NOT NULL";
-        MYSQL_RES* res = db.executeQueryWithResult(query);
-        if (!res) {
-            cerr << "No resumes found in the database\n";
+        if (store.size() == 0) {
+            cout << "No resumes found in the database\n";
             return;
         }
 
-        map<int, map<string, double>> tfData;
-        map<int, string> userNames;
-        map<int, vector<string>> resumeWords;
-        
-        MYSQL_ROW row;
-        while ((row = mysql_fetch_row(res))) {
-            int userId = atoi(row[0]);
-            string name = row[1];
-            string resume = row[2];
+        // Ground truth per query: brute-force hashed cosine, exact cosine, current TF-IDF scorer
+        vector<vector<float>> queryVectors;
+        vector<vector<int>> truthHashed, truthCosine, truthTfidf;
+        double bruteMs = 0.0, tfidfMs = 0.0;
+
+        for (const string& q : queries) {
+            vector<string> jobWords = analyzer.analyze(q);
+            WeightedQuery query = weighQuery(jobWords);
+            queryVectors.push_back(hashedVector(query.terms, max<int>(jobWords.size(), 1)));
+
+            start = chrono::steady_clock::now();
+            vector<pair<int, double>> brute;
+            for (size_t i = 0; i < store.size(); i++) {
+                vector<float> docVector = documentVector(static_cast<int>(i));
+                double dot = 0.0;
+                for (int d = 0; d < ANN_DIMENSIONS; d++) dot += docVector[d] * queryVectors.back()[d];
+                brute.push_back({static_cast<int>(i), dot});
+            }
+            sort(brute.begin(), brute.end(), 
+                [](const pair<int, double>& a, const pair<int, double>& b) { return a.second > b.second; });
+            bruteMs += elapsedMs(start);
+            truthHashed.push_back(topPositives(brute, ANN_TOP_K));
+
+            vector<pair<int, double>> cosine;
+            for (size_t i = 0; i < store.size(); i++) {
+                int position = static_cast<int>(i);
+                store.decode(position, scratch);
+                cosine.push_back({position, calculateCosine(scratch, store.totalWords(position), query.terms)});
+            }
+            sort(cosine.begin(), cosine.end(), 
+                [](const pair<int, double>& a, const pair<int, double>& b) { return a.second > b.second; });
+            truthCosine.push_back(topPositives(cosine, ANN_TOP_K));
+
+            start = chrono::steady_clock::now();
+            vector<pair<int, double>> tfidf = exactRanking(query);
+            tfidfMs += elapsedMs(start);
+            truthTfidf.push_back(topPositives(tfidf, ANN_TOP_K));
+        }
+
+        cout << "\nANN Recall Benchmark (" << store.size() << " resumes, " 
+             << queries.size() << " queries, K=" << ANN_TOP_K << ", dim=" << ANN_DIMENSIONS << ")\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << fixed << setprecision(3);
+        cout << "Index build:              " << buildMs << " ms\n";
+        cout << "Exact TF-IDF scan:        " << tfidfMs / queries.size() << " ms/query\n";
+        cout << "Brute-force hashed scan:  " << bruteMs / queries.size() << " ms/query\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << left << setw(10) << "efSearch" << setw(14) << "ms/query" << setw(14) << "R@K hashed" 
+             << setw(14) << "R@K cosine" << "R@K TF-IDF\n";
+
+        const int efValues[] = {10, 20, 50, 100, 200};
+        for (int ef : efValues) {
+            double annMs = 0.0, recallHashed = 0.0, recallCosine = 0.0, recallTfidf = 0.0;
+            int nHashed = 0, nCosine = 0, nTfidf = 0;
+
+            for (size_t q = 0; q < queryVectors.size(); q++) {
+                start = chrono::steady_clock::now();
+                vector<pair<int, double>> hits = annIndex.search(queryVectors[q], ANN_TOP_K, ef);
+                annMs += elapsedMs(start);
+
+                if (!truthHashed[q].empty()) { recallHashed += recallOf(hits, truthHashed[q]); nHashed++; }
+                if (!truthCosine[q].empty()) { recallCosine += recallOf(hits, truthCosine[q]); nCosine++; }
+                if (!truthTfidf[q].empty()) { recallTfidf += recallOf(hits, truthTfidf[q]); nTfidf++; }
+            }
 
-            vector<string> words = Utils::tokenize(resume);
-            allResumes.push_back(words);
-            resumeWords[userId] = words;
-            tfData[userId] = calculateTF(words);
-            userNames[userId] = name;
+            cout << left << setw(10) << ef << setw(14) << annMs / queryVectors.size()
+                 << setw(14) << (nHashed ? recallHashed / nHashed : 0.0)
+                 << setw(14) << (nCosine ? recallCosine / nCosine : 0.0)
+                 << (nTfidf ? recallTfidf / nTfidf : 0.0) << "\n";
         }
-        mysql_free_result(res);
+        cout << "-----------------------------------------------------------------\n";
+    }
+
+    // Compares FULLTEXT pushdown with the in-process engines: latency per
+    // query and overlap of its top K with the exact TF-IDF top K
+    void benchmarkFullText(const string& sampleQuery) {
+        vector<string> queries = loadBenchmarkQueries(sampleQuery);
+        syncResumes();
+        ensureGraph();
 
-        if (allResumes.empty()) {
+        if (store.size() == 0) {
             cout << "No resumes found in the database\n";
             return;
         }
 
-        // Calculate IDF using all resumes
-        map<string, double> idf = calculateIDF(allResumes);
-
-        // Compute TF-IDF scores for each resume
-        for (auto &entry : tfData) {
-            int userId = entry.first;
-            double score = calculateTFIDFScore(entry.second, idf, jobWords);
-            rankedResumes.push_back({userId, score});
+        double exactMs = 0.0, annMs = 0.0, fullTextMs = 0.0;
+        double overlap = 0.0;
+        int compared = 0;
+
+        for (const string& q : queries) {
+            vector<string> jobWords = analyzer.analyze(q);
+
+            auto start = chrono::steady_clock::now();
+            WeightedQuery query = weighQuery(jobWords);
+            vector<pair<int, double>> exact = exactRanking(query);
+            exactMs += elapsedMs(start);
+
+            start = chrono::steady_clock::now();
+            annIndex.search(hashedVector(query.terms, max<int>(jobWords.size(), 1)), ANN_TOP_K, efSearch);
+            annMs += elapsedMs(start);
+
+            start = chrono::steady_clock::now();
+            vector<int> userIds;
+            vector<RankedCandidate> pushed;
+            fullTextRanking(q, FULLTEXT_TOP_K, userIds, pushed);
+            fullTextMs += elapsedMs(start);
+
+            vector<int> truth;
+            for (int position : topPositives(exact, FULLTEXT_TOP_K)) truth.push_back(store.userId(position));
+            sort(truth.begin(), truth.end());
+            if (truth.empty()) continue;
+
+            vector<pair<int, double>> pushedIds;
+            for (size_t i = 0; i < userIds.size(); i++) pushedIds.push_back({userIds[i], pushed[i].score});
+            overlap += recallOf(pushedIds, truth);
+            compared++;
         }
 
-        // Sort resumes by highest TF-IDF score
-        sort(rankedResumes.begin(), rankedResumes.end(), 
-            [](const pair<int, double>& a, const pair<int, double>& b) {
-                return a.second > b.second;
-            });
+        size_t n = queries.size();
+        cout << "\nFULLTEXT Pushdown Benchmark (" << store.size() << " resumes, " 
+             << n << " queries, K=" << FULLTEXT_TOP_K << ")\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << fixed << setprecision(3);
+        cout << left << setw(36) << "Engine" << "ms/query\n";
+        cout << left << setw(36) << "Exact TF-IDF (resident store)" << exactMs / n << "\n";
+        cout << left << setw(36) << "HNSW cosine (resident)" << annMs / n << "\n";
+        cout << left << setw(36) << "MySQL MATCH ... AGAINST (top K)" << fullTextMs / n << "\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << "FULLTEXT overlap@K with exact TF-IDF: " << (compared ? overlap / compared : 0.0) 
+             << " (over " << compared << " queries)\n";
+        cout << "-----------------------------------------------------------------\n";
+    }
 
-        // Display ranked results
-        cout << "\nTop Matching Candidates:\n";
+    // Index size and exact-ranking latency for each stage of the analysis pipeline
+    void benchmarkAnalysis(const string& sampleQuery) {
+        vector<string> queries = loadBenchmarkQueries(sampleQuery);
+        AnalyzerOptions original = analyzer.getOptions();
+
+        struct Stage { const char* label; AnalyzerOptions options; };
+        const Stage stages[] = {
+            {"Raw tokens",            {false, false, false}},
+            {"+ synonyms",            {true,  false, false}},
+            {"+ stopwords",           {true,  true,  false}},
+            {"+ stemming (full)",     {true,  true,  true}}
+        };
+
+        cout << "\nText Analysis Impact (" << queries.size() << " queries)\n";
         cout << "-----------------------------------------------------------------\n";
-        cout << left << setw(5) << "Rank" << setw(20) << "Candidate" << setw(15) << "Score" << "Resume Excerpt\n";
+        cout << left << setw(20) << "Pipeline" << setw(9) << "Terms" << setw(12) << "Postings" 
+             << setw(13) << "Index bytes" << "ms/query\n";
+
+        for (const Stage& stage : stages) {
+            analyzer.setOptions(stage.options);
+            loadCorpus();
+
+            size_t postings = 0, bytes = 0;
+            for (size_t i = 0; i < store.size(); i++) {
+                store.decode(static_cast<int>(i), scratch);
+                postings += scratch.size();
+                bytes += store.encodedSize(static_cast<int>(i));
+            }
+
+            // Query analysis plus the exact scan over the store
+            auto start = chrono::steady_clock::now();
+            for (const string& q : queries) {
+                exactRanking(weighQuery(analyzer.analyze(q)));
+            }
+            double queryMs = elapsedMs(start) / queries.size();
+
+            cout << left << setw(20) << stage.label << setw(9) << store.termCount() << setw(12) << postings 
+                 << setw(13) << bytes << fixed << setprecision(3) << queryMs << "\n";
+        }
         cout << "-----------------------------------------------------------------\n";
-        
-        for (size_t i = 0; i < rankedResumes.size() && i < 10; ++i) {
-            int userId = rankedResumes[i].first;
-            string excerpt = resumeWords[userId].size() > 5 ? 
-                resumeWords[userId][0] + " " + resumeWords[userId][1] + "..." : "";
-            
-            cout << left << setw(5) << i+1 
-                 << setw(20) << userNames[userId] 
-                 << setw(15) << fixed << setprecision(3) << rankedResumes[i].second
-                 << excerpt << "\n";
+
+        analyzer.setOptions(original);
+        corpusLoaded = false;
+    }
+
+    // Checks the merged shard top-K against the single-process ranking of the
+    // whole corpus (same users, same order, bit-identical scores) and compares latency
+    void benchmarkSharding(const string& sampleQuery) {
+        if (shards.empty() && !startShards(SHARD_DEFAULT_WORKERS)) return;
+        vector<string> queries = loadBenchmarkQueries(sampleQuery);
+        syncResumes();
+
+        if (store.size() == 0) {
+            cout << "No resumes found in the database\n";
+            return;
         }
+
+        double singleMs = 0.0, shardedMs = 0.0, maxDifference = 0.0;
+        size_t identical = 0;
+        for (const string& q : queries) {
+            auto start = chrono::steady_clock::now();
+            vector<pair<int, double>> exact = exactRanking(weighQuery(analyzer.analyze(q)));
+            singleMs += elapsedMs(start);
+
+            start = chrono::steady_clock::now();
+            vector<ShardHit> hits;
+            if (!shardedRanking(q, SHARD_TOP_K, hits)) return;
+            shardedMs += elapsedMs(start);
+
+            bool same = hits.size() == min<size_t>(SHARD_TOP_K, exact.size());
+            for (size_t i = 0; i < hits.size() && i < exact.size(); i++) {
+                same = same && hits[i].userId == store.userId(exact[i].first) && 
+                       hits[i].candidate.score == exact[i].second;
+                maxDifference = max(maxDifference, fabs(hits[i].candidate.score - exact[i].second));
+            }
+            if (same) identical++;
+        }
+
+        double n = queries.size();
+        cout << "\nSharding Verification (" << queries.size() << " queries, " << store.size() << " resumes, " 
+             << shards.size() << " shards, top " << SHARD_TOP_K << ")\n";
+        cout << "-----------------------------------------------------------------\n";
+        printShards();
+        cout << "-----------------------------------------------------------------\n";
+        cout << fixed << setprecision(3);
+        cout << left << setw(36) << "Engine" << "ms/query\n";
+        cout << left << setw(36) << "Single process (exact TF-IDF)" << singleMs / n << "\n";
+        cout << left << setw(36) << "Scatter-gather over shards" << shardedMs / n << "\n";
+        cout << "-----------------------------------------------------------------\n";
+        cout << "Queries with identical top-K: " << identical << " / " << queries.size() << "\n";
+        cout << "Max score difference: " << scientific << maxDifference << fixed << "\n";
         cout << "-----------------------------------------------------------------\n";
     }
 };
@@ -539,10 +3220,11 @@ public:
 class JobRecruitmentSystem {
 private:
     Database db;
-    UserManager userManager;
-    JobManager jobManager;
     JobSearchEngine jobSearch;
     JobMatcher jobMatcher;
+    WriteQueue writeQueue;  // destroyed (and drained) before the indexes its hook updates
+    UserManager userManager;
+    JobManager jobManager;
 
     void showMainMenu() {
         Utils::clearScreen();
@@ -566,6 +3248,7 @@ private:
                 cout << "3. Post Job\n";
                 cout << "4. View All Jobs\n";
                 cout << "5. Search Candidates\n";
+                cout << "7. Diagnostics\n";
             } else {
                 cout << "3. Update Resume\n";
                 cout << "4. Search Jobs\n";
@@ -603,7 +3286,8 @@ private:
             getline(cin, resume);
         }
 
-        if (userManager.registerUser(db, name, email, password, role, resume)) {
+        WriteResult result = userManager.registerUser(writeQueue, name, email, password, role, resume).get();
+        if (result.committed) {
             cout << "\nRegistration successful!\n";
         } else {
             cout << "\nRegistration failed. Please try again.\n";
@@ -656,9 +3340,9 @@ private:
         cin >> salary;
         cin.ignore();
         
-        if (jobManager.postJob(userManager.getUserId(), title, description, location, skills, salary)) {
+        WriteResult result = jobManager.postJob(userManager.getUserId(), title, description, location, skills, salary).get();
+        if (result.committed) {
             cout << "\nJob posted successfully!\n";
-            jobSearch = JobSearchEngine(db); // Refresh search index
         } else {
             cout << "\nFailed to post job. Please try again.\n";
         }
@@ -682,7 +3366,7 @@ private:
         cout << "Enter new resume text:\n";
         getline(cin, newResume);
         
-        userManager.updateResume(db, newResume);
+        userManager.updateResume(writeQueue, newResume);
         Utils::pause();
     }
 
@@ -691,11 +3375,17 @@ private:
         cout << "JOB SEARCH\n";
         cout << "----------------------------------------\n";
         
-        string keyword;
+        string keyword, mode;
         cout << "Enter job title keyword: ";
         getline(cin, keyword);
+        cout << "Search mode (1 = Title prefix, 2 = Title words (FULLTEXT), 3 = Title and description (FULLTEXT)) [1]: ";
+        getline(cin, mode);
         
-        jobSearch.searchJobs(keyword);
+        if (mode == "2" || mode == "3") {
+            jobSearch.searchJobsFullText(keyword, mode == "3");
+        } else {
+            jobSearch.searchJobs(keyword);
+        }
         Utils::pause();
     }
 
@@ -710,19 +3400,114 @@ private:
         cout << "FIND CANDIDATES\n";
         cout << "----------------------------------------\n";
         
-        string jobDescription;
+        string jobDescription, mode;
         cout << "Enter job description to match candidates:\n";
         getline(cin, jobDescription);
+        cout << "Ranking mode (1 = Exact TF-IDF, 2 = Approximate cosine, 3 = MySQL FULLTEXT, 4 = Sharded workers) [1]: ";
+        getline(cin, mode);
         
-        jobMatcher.rankResumes(jobDescription);
+        if (mode == "2") {
+            jobMatcher.rankResumesApprox(jobDescription);
+        } else if (mode == "3") {
+            jobMatcher.rankResumesFullText(jobDescription);
+        } else if (mode == "4") {
+            jobMatcher.rankResumesSharded(jobDescription);
+        } else {
+            jobMatcher.rankResumes(jobDescription);
+        }
+        Utils::pause();
+    }
+
+    void handleDiagnostics() {
+        if (!userManager.isLoggedIn() || userManager.getRole() != "Recruiter") {
+            cout << "Unauthorized action\n";
+            Utils::pause();
+            return;
+        }
+
+        Utils::clearScreen();
+        cout << "DIAGNOSTICS\n";
+        cout << "----------------------------------------\n";
+        cout << "1. ANN recall benchmark\n";
+        cout << "2. Set ANN search breadth (current efSearch: " << jobMatcher.getSearchEf() << ")\n";
+        cout << "3. Write pipeline statistics\n";
+        cout << "4. FULLTEXT pushdown benchmark\n";
+        cout << "5. Resume store memory report\n";
+        cout << "6. Set resume postings memory budget (current: " << jobMatcher.getMemoryBudget() << " bytes)\n";
+        cout << "7. Text analysis impact benchmark\n";
+        cout << "8. Configure text analysis (synonyms/stopwords/stemming: " 
+             << jobMatcher.getAnalyzerOptions().expandSynonyms << "/" 
+             << jobMatcher.getAnalyzerOptions().removeStopwords << "/" 
+             << jobMatcher.getAnalyzerOptions().stem << ")\n";
+        cout << "9. Start/stop shard workers (running: " << jobMatcher.shardCount() << ")\n";
+        cout << "10. Sharding verification benchmark\n";
+        cout << "Enter your choice: ";
+
+        string choice;
+        getline(cin, choice);
+
+        if (choice == "1" || choice == "4" || choice == "7" || choice == "10") {
+            string sample;
+            cout << "Sample job description (used when no jobs are posted):\n";
+            getline(cin, sample);
+            if (choice == "1") jobMatcher.benchmarkRecall(sample);
+            else if (choice == "4") jobMatcher.benchmarkFullText(sample);
+            else if (choice == "7") jobMatcher.benchmarkAnalysis(sample);
+            else jobMatcher.benchmarkSharding(sample);
+        } else if (choice == "2") {
+            string ef;
+            cout << "efSearch (higher = better recall, slower): ";
+            getline(cin, ef);
+            jobMatcher.setSearchEf(atoi(ef.c_str()));
+            cout << "efSearch set to " << jobMatcher.getSearchEf() << "\n";
+        } else if (choice == "3") {
+            writeQueue.printStats();
+        } else if (choice == "5") {
+            jobMatcher.printMemoryReport();
+        } else if (choice == "6") {
+            string budget;
+            cout << "Postings memory budget in bytes: ";
+            getline(cin, budget);
+            jobMatcher.setMemoryBudget(strtoull(budget.c_str(), nullptr, 10));
+            cout << "Postings memory budget set to " << jobMatcher.getMemoryBudget() << " bytes\n";
+        } else if (choice == "8") {
+            AnalyzerOptions options;
+            string answer;
+            cout << "Expand synonyms (y/n): ";
+            getline(cin, answer);
+            options.expandSynonyms = answer == "y";
+            cout << "Remove stopwords (y/n): ";
+            getline(cin, answer);
+            options.removeStopwords = answer == "y";
+            cout << "Stem words (y/n): ";
+            getline(cin, answer);
+            options.stem = answer == "y";
+            jobMatcher.setAnalyzerOptions(options);
+            cout << "Text analysis updated; resumes will be re-indexed on the next search\n";
+        } else if (choice == "9") {
+            string workers;
+            cout << "Number of shard workers (0 = stop) [" << SHARD_DEFAULT_WORKERS << "]: ";
+            getline(cin, workers);
+            int count = workers.empty() ? SHARD_DEFAULT_WORKERS : atoi(workers.c_str());
+            if (count <= 0) jobMatcher.stopShards();
+            else jobMatcher.startShards(count);
+            jobMatcher.printShards();
+        } else {
+            cout << "Invalid choice.\n";
+        }
         Utils::pause();
     }
 
 public:
     JobRecruitmentSystem() : 
-        jobManager(db), 
         jobSearch(db), 
-        jobMatcher(db) {}
+        jobMatcher(db), 
+        jobManager(db, writeQueue) {
+        // Resume changes reach the matcher through its delta sync
+        writeQueue.setCommitHook([this](const PendingWrite& write, int id) {
+            if (write.kind == WriteKind::PostJob) jobSearch.indexJob(id, write.fields[0]);
+        });
+    }
 
     void run() {
         int choice;
@@ -795,6 +3580,14 @@ public:
                         Utils::pause();
                     }
                     break;
+                case 7:
+                    if (userManager.isLoggedIn() && userManager.getRole() == "Recruiter") {
+                        handleDiagnostics();
+                    } else {
+                        cout << "Invalid choice. Please try again.\n";
+                        Utils::pause();
+                    }
+                    break;
                 case 0:
                     cout << "Exiting system...\n";
                     break;
@@ -806,7 +3599,14 @@ public:
     }
 };
 
-int main() {
+int main(int argc, char* argv[]) {
+#ifndef _WIN32
+    if (argc > 1 && strcmp(argv[1], SHARD_WORKER_FLAG) == 0) return JobMatcher::runShardWorker(argc, argv);
+    JobMatcher::setWorkerExecutable(argv[0]);
+#else
+    (void)argc;  // shards run in-process; there is no worker command line
+    (void)argv;
+#endif
     try {
         JobRecruitmentSystem system;
         system.run();